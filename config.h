@@ -0,0 +1,106 @@
+/* This file is automatically generated by configure */
+/* DO NOT EDIT MANUALLY */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+
+#define SCUMM_LITTLE_ENDIAN
+#undef SCUMM_BIG_ENDIAN
+#undef SCUMM_NEED_ALIGNMENT
+#define HAVE_AMD64
+#define WITHOUT_SDL
+#undef USE_SDL_NET
+#undef USE_ELF_LOADER
+#undef DYNAMIC_MODULES
+#define DETECTION_STATIC
+#define DETECTION_FULL
+#define USE_MT32EMU
+#undef DISABLE_NUKED_OPL
+#define USE_RGB_COLOR
+#define USE_HIGHRES
+#define USE_SAVEGAME_TIMESTAMP
+#define USE_SCALERS
+#define USE_HQ_SCALERS
+#define USE_EDGE_SCALERS
+#define USE_ASPECT
+#undef USE_OGG
+#undef USE_VORBIS
+#undef USE_TREMOR
+#undef ENABLE_OPL2LPT
+#undef USE_RETROWAVE
+#undef USE_FLAC
+#undef USE_MAD
+#undef USE_ALSA
+#define USE_JPEG
+#define USE_PNG
+#undef USE_FAAD
+#define USE_SEQ_MIDI
+#undef USE_SNDIO
+#define USE_TIMIDITY
+#define USE_ZLIB
+#undef USE_A52
+#define USE_LIBCURL
+#define USE_HTTP
+#undef USE_OPENMPT
+#undef USE_MIKMOD
+#undef USE_DLC
+#undef USE_SCUMMVMDLC
+#undef USE_FLUIDSYNTH
+#undef USE_FLUIDLITE
+#undef USE_SONIVOX
+#define USE_READLINE
+#define USE_TEXT_CONSOLE_FOR_DEBUGGER
+#undef USE_UNITY
+#undef USE_GTK
+#define USE_FREETYPE2
+#undef USE_OPENGL
+#undef USE_GLAD
+#undef USE_OPENGL_GAME
+#undef USE_OPENGL_SHADERS
+#define USE_LINUXCD
+#undef USE_NASM
+#undef USE_PANDOC
+#define USE_CURL
+#undef USE_FRIBIDI
+#undef ENABLE_TEST_CPP_11
+#undef USE_DISCORD
+#undef ENABLE_VKEYBD
+#undef ENABLE_EVENTRECORDER
+#define USE_TRANSLATION
+#define USE_DETECTLANG
+#undef USE_TASKBAR
+#undef USE_SYSDIALOGS
+#undef USE_TTS
+#define USE_BINK
+#undef USE_UPDATES
+#define USE_CLOUD
+#define BUILTIN_RESOURCES
+#define SCUMMVM_SSE2
+#define SCUMMVM_AVX2
+#undef SCUMMVM_NEON
+
+/* components */
+/* #define USE_ENET */
+#define USE_FMTOWNS_PC98_AUDIO
+/* #define USE_GIF */
+/* #define USE_HNM */
+/* #define USE_IMGUI */
+#define USE_INDEO3
+/* #define USE_INDEO45 */
+/* #define USE_LUA */
+/* #define USE_VPX */
+/* #define USE_THEORADEC */
+#define USE_MIDI
+/* #define USE_MPCDEC */
+/* #define USE_MPEG2 */
+#define USE_QDM2
+#define USE_SID_AUDIO
+#define USE_SVQ1
+#define USE_TINYGL
+/* #define USE_UNIVERSALTRACKER */
+/* #define USE_VGMTRANS_AUDIO */
+/* end of components */
+#define TAINTED_BUILD
+
+#endif /* CONFIG_H */
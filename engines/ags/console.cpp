@@ -36,6 +36,7 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache_stats",  WRAP_METHOD(AGSConsole, Cmd_spriteCacheStats));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -245,6 +246,27 @@ bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_spriteCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_GP(spriteset).ResetStats();
+		debugPrintf("Sprite cache statistics reset\n");
+		return true;
+	}
+
+	const AGS3::Shared::SpriteCache::Stats &stats = _GP(spriteset).GetStats();
+	debugPrintf("Size: %u KB of %u KB (%u KB locked)\n", (uint)(_GP(spriteset).GetCacheSize() / 1024),
+				(uint)(_GP(spriteset).GetMaxCacheSize() / 1024), (uint)(_GP(spriteset).GetLockedSize() / 1024));
+	debugPrintf("Hits: %u\n", stats.Hits);
+	debugPrintf("Misses: %u (%u ms spent loading)\n", stats.Misses, stats.StallMs);
+	debugPrintf("Prefetched: %u\n", stats.Prefetches);
+	return true;
+}
+
 LogOutputTarget::LogOutputTarget() {
 }
 
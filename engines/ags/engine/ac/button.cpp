@@ -21,6 +21,7 @@
 
 #include "ags/engine/ac/button.h"
 #include "ags/shared/ac/common.h"
+#include "ags/engine/ac/game.h"
 #include "ags/engine/ac/gui.h"
 #include "ags/shared/ac/view.h"
 #include "ags/shared/ac/game_setup_struct.h"
@@ -76,6 +77,7 @@ void Button_Animate(GUIButton *butt, int view, int loop, int speed,	int repeat,
 	abtn.blocking = blocking;
 	abtn.direction = direction;
 	abtn.frame = SetFirstAnimFrame(view, loop, sframe, direction);
+	prefetch_view_loop(view, loop);
 	abtn.wait = abtn.speed + _GP(views)[abtn.view].loops[abtn.loop].frames[abtn.frame].speed;
 	abtn.volume = volume;
 	_GP(animbuts).push_back(abtn);
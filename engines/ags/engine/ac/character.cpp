@@ -2077,6 +2077,7 @@ void animate_character(CharacterInfo *chap, int loopn, int sppd, int rept, int d
 	chap->set_animating(rept != 0, direction == 0, sppd);
 	chap->loop = loopn;
 	chap->frame = SetFirstAnimFrame(chap->view, loopn, sframe, direction);
+	prefetch_view_loop(chap->view, loopn);
 
 	chap->wait = sppd + _GP(views)[chap->view].loops[loopn].frames[chap->frame].speed;
 	_GP(charextra)[chap->index_id].cur_anim_volume = Math::Clamp(volume, 0, 100);
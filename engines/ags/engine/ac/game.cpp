@@ -1391,6 +1391,22 @@ void precache_view(int view, int first_loop, int last_loop, bool with_sounds) {
 	Debug::Printf("\tSprite cache: %zu -> %zu KB", spcache_before / 1024u, spcache_after / 1024u);
 }
 
+void prefetch_view_loop(int view, int loop) {
+	if ((view < 0) || (view >= _GP(game).numviews))
+		return;
+	if ((loop < 0) || (loop >= _GP(views)[view].numLoops))
+		return;
+
+	// Follow the loop through the "run next loop" chain, as the animation will
+	ViewStruct &aview = _GP(views)[view];
+	for (; loop < aview.numLoops; ++loop) {
+		for (int j = 0; j < aview.loops[loop].numFrames; ++j)
+			_GP(spriteset).PrefetchSprite(aview.loops[loop].frames[j].pic);
+		if (!aview.loops[loop].RunNextLoop())
+			break;
+	}
+}
+
 
 //=============================================================================
 //
@@ -216,6 +216,10 @@ void get_message_text(int msnum, char *buffer, char giveErr = 1);
 void game_sprite_updated(int sprnum, bool deleted = false);
 // Precaches sprites for a view, within a selected range of loops.
 void precache_view(int view, int first_loop = 0, int last_loop = INT32_MAX, bool with_sounds = false);
+// Loads the frames of a view loop into the sprite cache ahead of use, as long
+// as they fit without disposing other sprites; unlike precache_view, the
+// sprites are not locked.
+void prefetch_view_loop(int view, int loop);
 
 extern void set_loop_counter(unsigned int new_counter);
 
@@ -237,6 +237,7 @@ void AnimateObjectImpl(int obn, int loopn, int spdd, int rept, int direction, in
 	obj.set_animating(rept, direction == 0, spdd);
 	obj.loop = (uint16_t)loopn;
 	obj.frame = (uint16_t)SetFirstAnimFrame(obj.view, loopn, sframe, direction);
+	prefetch_view_loop(obj.view, loopn);
 	obj.wait = spdd + _GP(views)[obj.view].loops[loopn].frames[obj.frame].speed;
 	int pic = _GP(views)[obj.view].loops[loopn].frames[obj.frame].pic;
 	obj.num = Math::InRangeOrDef<uint16_t>(pic, 0);
@@ -846,6 +846,17 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 	}
 	init_room_drawdata();
 
+	// Load the sprites which will be displayed right away, as long as they fit
+	// into the sprite cache, rather than stall on them in the first frames
+	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
+		if (_G(objs)[cc].on == 1)
+			_GP(spriteset).PrefetchSprite(_G(objs)[cc].num);
+	}
+	for (int cc = 0; cc < _GP(game).numcharacters; cc++) {
+		if ((_GP(game).chars[cc].room == _G(displayed_room)) && _GP(game).chars[cc].on)
+			prefetch_view_loop(_GP(game).chars[cc].view, _GP(game).chars[cc].loop);
+	}
+
 	set_our_eip(212);
 	invalidate_screen();
 	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
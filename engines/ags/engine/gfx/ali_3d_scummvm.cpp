@@ -159,6 +159,7 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 
 	_lastTexPixels = nullptr;
 	_lastTexPitch = -1;
+	InvalidatePresentedFrame();
 }
 
 void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
@@ -173,6 +174,7 @@ void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
 void ScummVMRendererGraphicsDriver::ReleaseDisplayMode() {
 	OnModeReleased();
 	ClearDrawLists();
+	InvalidatePresentedFrame();
 }
 
 bool ScummVMRendererGraphicsDriver::SetNativeResolution(const GraphicResolution &native_res) {
@@ -195,6 +197,7 @@ void ScummVMRendererGraphicsDriver::UnInit() {
 	OnUnInit();
 	ReleaseDisplayMode();
 	DestroyVirtualScreen();
+	_presentedFrame.free();
 
 	sys_window_destroy();
 }
@@ -533,6 +536,58 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+void ScummVMRendererGraphicsDriver::copyChangedRects(const Graphics::Surface &src) {
+	if (!_presentedFrameValid || _presentedFrame.w != src.w || _presentedFrame.h != src.h ||
+			_presentedFrame.format != src.format) {
+		_presentedFrame.copyFrom(src);
+		_presentedFrameValid = true;
+		g_system->copyRectToScreen(src.getPixels(), src.pitch, 0, 0, src.w, src.h);
+		return;
+	}
+
+	// Most frames only change a few sprites and GUI controls over a static
+	// room, so compare against the previous frame and send the changed area
+	// of each horizontal strip, instead of the whole screen
+	const int kStripHeight = 16;
+	const int bpp = src.format.bytesPerPixel;
+	const int rowSize = src.w * bpp;
+
+	for (int stripY = 0; stripY < src.h; stripY += kStripHeight) {
+		const int stripEnd = MIN<int>(stripY + kStripHeight, src.h);
+		int x1 = src.w, x2 = -1, y1 = -1, y2 = -1;
+
+		for (int y = stripY; y < stripEnd; ++y) {
+			const byte *srcP = (const byte *)src.getBasePtr(0, y);
+			byte *destP = (byte *)_presentedFrame.getBasePtr(0, y);
+			if (memcmp(srcP, destP, rowSize) == 0)
+				continue;
+
+			int left = 0, right = src.w - 1;
+			while (memcmp(srcP + left * bpp, destP + left * bpp, bpp) == 0)
+				++left;
+			while (memcmp(srcP + right * bpp, destP + right * bpp, bpp) == 0)
+				--right;
+			memcpy(destP + left * bpp, srcP + left * bpp, (right - left + 1) * bpp);
+
+			x1 = MIN(x1, left);
+			x2 = MAX(x2, right);
+			if (y1 == -1)
+				y1 = y;
+			y2 = y;
+		}
+
+		if (x2 != -1)
+			g_system->copyRectToScreen(src.getBasePtr(x1, y1), src.pitch,
+				x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+	}
+}
+
+void ScummVMRendererGraphicsDriver::InvalidatePresentedFrame() {
+	_presentedFrameValid = false;
+	if (_screen)
+		_screen->markAllDirty();
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -608,9 +663,8 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	}
 
 	case kRenderDirect:
-		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
+		// Blit the changed parts of the virtual surface directly to the screen
+		copyChangedRects(src);
 		g_system->updateScreen();
 		if (srcTransformed) {
 			srcTransformed->free();
@@ -236,6 +236,7 @@ public:
 	bool GetStageMatrixes(RenderMatrixes & /*rm*/) override {
 		return false; /* not supported */
 	}
+	void InvalidatePresentedFrame() override;
 
 	typedef std::shared_ptr<ScummVMRendererGfxFilter> PSDLRenderFilter;
 
@@ -249,6 +250,10 @@ protected:
 
 private:
 	Graphics::Screen *_screen = nullptr;
+	// Copy of the last frame passed directly to the backend, used to only
+	// send the parts of the following frames that have actually changed
+	Graphics::Surface _presentedFrame;
+	bool _presentedFrameValid = false;
 	PSDLRenderFilter _filter;
 
 	bool _hasGamma = false;
@@ -300,6 +305,8 @@ private:
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	// Copy raw screen bitmap pixels to the screen
 	void copySurface(const Graphics::Surface &src, bool mode);
+	// Copy the changed parts of a screen format bitmap to the screen
+	void copyChangedRects(const Graphics::Surface &src);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
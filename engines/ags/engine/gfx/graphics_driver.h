@@ -254,6 +254,9 @@ public:
 	// These matrixes will be filled in accordance to the renderer's compatible format;
 	// returns false if renderer does not use matrixes (not a 3D renderer).
 	virtual bool GetStageMatrixes(RenderMatrixes &rm) = 0;
+	// Tells renderer that the screen contents were changed by someone else
+	// (e.g. video playback), and the next frame has to be presented in full.
+	virtual void InvalidatePresentedFrame() = 0;
 
 	virtual ~IGraphicsDriver() {}
 };
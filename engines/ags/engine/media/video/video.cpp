@@ -82,6 +82,9 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 
 	update_polled_stuff();
 
+	// Video frames are drawn straight to the backend screen
+	_G(gfxDriver)->InvalidatePresentedFrame();
+
 	decoder->start();
 	while (!SHOULD_QUIT && !decoder->endOfVideo()) {
 		if (decoder->needsUpdate()) {
@@ -535,6 +535,10 @@ void _aa_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2, uint32_
 	unsigned int r1, g1, b1;
 	unsigned int r2, g2, b2;
 	unsigned int scolor;
+	/* Channel shifts are fetched once, rather than for every source pixel.  */
+	const int rshift = _G(_rgb_r_shift_32);
+	const int gshift = _G(_rgb_g_shift_32);
+	const int bshift = _G(_rgb_b_shift_32);
 
 	sy1i = _sy1 >> aa_BITS;
 	sy = sy1i;
@@ -546,24 +550,24 @@ void _aa_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2, uint32_
 
 	sx1f = aa_SIZE - (_sx1 & aa_MASK);
 	scolor = *sline;
-	r1 = MUL(getr32(scolor), sx1f);
-	g1 = MUL(getg32(scolor), sx1f);
-	b1 = MUL(getb32(scolor), sx1f);
+	r1 = MUL(((scolor >> rshift) & 0xFF), sx1f);
+	g1 = MUL(((scolor >> gshift) & 0xFF), sx1f);
+	b1 = MUL(((scolor >> bshift) & 0xFF), sx1f);
 
 	sx2i = _sx2 >> aa_BITS;
 	for (sline++, sx++; sx < sx2i; sline++, sx++) {
 		scolor = *sline;
-		r1 += getr32(scolor) << aa_BITS;
-		g1 += getg32(scolor) << aa_BITS;
-		b1 += getb32(scolor) << aa_BITS;
+		r1 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+		g1 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+		b1 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 	}
 
 	sx2f = _sx2 & aa_MASK;
 	if (sx2f != 0) {
 		scolor = *sline;
-		r1 += MUL(getr32(scolor), sx2f);
-		g1 += MUL(getg32(scolor), sx2f);
-		b1 += MUL(getb32(scolor), sx2f);
+		r1 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+		g1 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+		b1 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 	}
 
 	sy1f = aa_SIZE - (_sy1 & aa_MASK);
@@ -580,22 +584,22 @@ void _aa_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2, uint32_
 			sline = (unsigned int *)(_src->line[sy]) + sx;
 
 			scolor = *sline;
-			r2 += MUL(getr32(scolor), sx1f);
-			g2 += MUL(getg32(scolor), sx1f);
-			b2 += MUL(getb32(scolor), sx1f);
+			r2 += MUL(((scolor >> rshift) & 0xFF), sx1f);
+			g2 += MUL(((scolor >> gshift) & 0xFF), sx1f);
+			b2 += MUL(((scolor >> bshift) & 0xFF), sx1f);
 
 			for (sline++, sx++; sx < sx2i; sline++, sx++) {
 				scolor = *sline;
-				r2 += getr32(scolor) << aa_BITS;
-				g2 += getg32(scolor) << aa_BITS;
-				b2 += getb32(scolor) << aa_BITS;
+				r2 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+				g2 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+				b2 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 			}
 
 			if (sx2f != 0) {
 				scolor = *sline;
-				r2 += MUL(getr32(scolor), sx2f);
-				g2 += MUL(getg32(scolor), sx2f);
-				b2 += MUL(getb32(scolor), sx2f);
+				r2 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+				g2 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+				b2 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 			}
 		} while (++sy < sy2i);
 
@@ -611,22 +615,22 @@ void _aa_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2, uint32_
 		sline = (unsigned int *)(_src->line[sy]) + sx;
 
 		scolor = *sline;
-		r2 = MUL(getr32(scolor), sx1f);
-		g2 = MUL(getg32(scolor), sx1f);
-		b2 = MUL(getb32(scolor), sx1f);
+		r2 = MUL(((scolor >> rshift) & 0xFF), sx1f);
+		g2 = MUL(((scolor >> gshift) & 0xFF), sx1f);
+		b2 = MUL(((scolor >> bshift) & 0xFF), sx1f);
 
 		for (sline++, sx++; sx < sx2i; sline++, sx++) {
 			scolor = *sline;
-			r2 += getr32(scolor) << aa_BITS;
-			g2 += getg32(scolor) << aa_BITS;
-			b2 += getb32(scolor) << aa_BITS;
+			r2 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+			g2 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+			b2 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 		}
 
 		if (sx2f != 0) {
 			scolor = *sline;
-			r2 += MUL(getr32(scolor), sx2f);
-			g2 += MUL(getg32(scolor), sx2f);
-			b2 += MUL(getb32(scolor), sx2f);
+			r2 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+			g2 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+			b2 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 		}
 
 		r1 += MUL(r2, sy2f);
@@ -1378,6 +1382,10 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 	unsigned int r1, g1, b1;
 	unsigned int r2, g2, b2, t2;
 	unsigned int scolor;
+	/* Channel shifts are fetched once, rather than for every source pixel.  */
+	const int rshift = _G(_rgb_r_shift_32);
+	const int gshift = _G(_rgb_g_shift_32);
+	const int bshift = _G(_rgb_b_shift_32);
 
 	sy1i = _sy1 >> aa_BITS;
 	sy = sy1i;
@@ -1390,9 +1398,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 	sx1f = aa_SIZE - (_sx1 & aa_MASK);
 	scolor = *sline;
 	if (scolor != MASK_COLOR_32) {
-		r1 = MUL(getr32(scolor), sx1f);
-		g1 = MUL(getg32(scolor), sx1f);
-		b1 = MUL(getb32(scolor), sx1f);
+		r1 = MUL(((scolor >> rshift) & 0xFF), sx1f);
+		g1 = MUL(((scolor >> gshift) & 0xFF), sx1f);
+		b1 = MUL(((scolor >> bshift) & 0xFF), sx1f);
 		_G(t1) = 0;
 	} else {
 		r1 = g1 = b1 = 0;
@@ -1403,9 +1411,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 	for (sline++, sx++; sx < sx2i; sline++, sx++) {
 		scolor = *sline;
 		if (scolor != MASK_COLOR_32) {
-			r1 += getr32(scolor) << aa_BITS;
-			g1 += getg32(scolor) << aa_BITS;
-			b1 += getb32(scolor) << aa_BITS;
+			r1 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+			g1 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+			b1 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 		} else
 			_G(t1) += aa_SIZE;
 	}
@@ -1414,9 +1422,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 	if (sx2f != 0) {
 		scolor = *sline;
 		if (scolor != MASK_COLOR_32) {
-			r1 += MUL(getr32(scolor), sx2f);
-			g1 += MUL(getg32(scolor), sx2f);
-			b1 += MUL(getb32(scolor), sx2f);
+			r1 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+			g1 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+			b1 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 		} else
 			_G(t1) += sx2f;
 	}
@@ -1437,18 +1445,18 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 
 			scolor = *sline;
 			if (scolor != MASK_COLOR_32) {
-				r2 += MUL(getr32(scolor), sx1f);
-				g2 += MUL(getg32(scolor), sx1f);
-				b2 += MUL(getb32(scolor), sx1f);
+				r2 += MUL(((scolor >> rshift) & 0xFF), sx1f);
+				g2 += MUL(((scolor >> gshift) & 0xFF), sx1f);
+				b2 += MUL(((scolor >> bshift) & 0xFF), sx1f);
 			} else
 				t2 += sx1f;
 
 			for (sline++, sx++; sx < sx2i; sline++, sx++) {
 				scolor = *sline;
 				if (scolor != MASK_COLOR_32) {
-					r2 += getr32(scolor) << aa_BITS;
-					g2 += getg32(scolor) << aa_BITS;
-					b2 += getb32(scolor) << aa_BITS;
+					r2 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+					g2 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+					b2 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 				} else
 					t2 += aa_SIZE;
 			}
@@ -1456,9 +1464,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 			if (sx2f != 0) {
 				scolor = *sline;
 				if (scolor != MASK_COLOR_32) {
-					r2 += MUL(getr32(scolor), sx2f);
-					g2 += MUL(getg32(scolor), sx2f);
-					b2 += MUL(getb32(scolor), sx2f);
+					r2 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+					g2 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+					b2 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 				} else
 					t2 += sx2f;
 			}
@@ -1478,9 +1486,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 
 		scolor = *sline;
 		if (scolor != MASK_COLOR_32) {
-			r2 = MUL(getr32(scolor), sx1f);
-			g2 = MUL(getg32(scolor), sx1f);
-			b2 = MUL(getb32(scolor), sx1f);
+			r2 = MUL(((scolor >> rshift) & 0xFF), sx1f);
+			g2 = MUL(((scolor >> gshift) & 0xFF), sx1f);
+			b2 = MUL(((scolor >> bshift) & 0xFF), sx1f);
 			t2 = 0;
 		} else {
 			r2 = g2 = b2 = 0;
@@ -1490,9 +1498,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 		for (sline++, sx++; sx < sx2i; sline++, sx++) {
 			scolor = *sline;
 			if (scolor != MASK_COLOR_32) {
-				r2 += getr32(scolor) << aa_BITS;
-				g2 += getg32(scolor) << aa_BITS;
-				b2 += getb32(scolor) << aa_BITS;
+				r2 += ((scolor >> rshift) & 0xFF) << aa_BITS;
+				g2 += ((scolor >> gshift) & 0xFF) << aa_BITS;
+				b2 += ((scolor >> bshift) & 0xFF) << aa_BITS;
 			} else
 				t2 += aa_SIZE;
 		}
@@ -1500,9 +1508,9 @@ void _aa_masked_add_rgb32(BITMAP *_src, int _sx1, int _sx2, int _sy1, int _sy2,
 		if (sx2f != 0) {
 			scolor = *sline;
 			if (scolor != MASK_COLOR_32) {
-				r2 += MUL(getr32(scolor), sx2f);
-				g2 += MUL(getg32(scolor), sx2f);
-				b2 += MUL(getb32(scolor), sx2f);
+				r2 += MUL(((scolor >> rshift) & 0xFF), sx2f);
+				g2 += MUL(((scolor >> gshift) & 0xFF), sx2f);
+				b2 += MUL(((scolor >> bshift) & 0xFF), sx2f);
 			} else
 				t2 += sx2f;
 		}
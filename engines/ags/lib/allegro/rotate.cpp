@@ -58,6 +58,34 @@ void rotate_scale_coordinates(fixed w, fixed h,
 	ys[br] = ys[tr] + ys[bl] - ys[tl];
 }
 
+/* drawScanline:
+ *  Draws one scanline of a mapped sprite, when both bitmaps share the same
+ *  pixel format and the scanline is known to lie within both of them.
+ */
+template<typename PixelType>
+static void drawScanline(BITMAP *bmp, const BITMAP *spr, int bmp_y, int bmp_x1, int bmp_x2,
+		fixed spr_x, fixed spr_y, fixed spr_dx, fixed spr_dy, uint32 alphaMask, uint32 transColor) {
+	PixelType *dest = (PixelType *)bmp->getBasePtr(bmp_x1, bmp_y);
+	const byte *sprPixels = (const byte *)spr->getPixels();
+	const int sprPitch = spr->pitch;
+
+	if (spr_dy == 0) {
+		// Unrotated sprites read the whole scanline from a single source row
+		const PixelType *srcRow = (const PixelType *)(sprPixels + (spr_y >> 16) * sprPitch);
+		for (int x = bmp_x1; x <= bmp_x2; ++x, ++dest, spr_x += spr_dx) {
+			const PixelType c = srcRow[spr_x >> 16];
+			if ((c & alphaMask) != transColor)
+				*dest = c;
+		}
+	} else {
+		for (int x = bmp_x1; x <= bmp_x2; ++x, ++dest, spr_x += spr_dx, spr_y += spr_dy) {
+			const PixelType c = ((const PixelType *)(sprPixels + (spr_y >> 16) * sprPitch))[spr_x >> 16];
+			if ((c & alphaMask) != transColor)
+				*dest = c;
+		}
+	}
+}
+
 /* parallelogram_map:
  *  Worker routine for drawing rotated and/or scaled and/or flipped sprites:
  *  It actually maps the sprite to any parallelogram-shaped area of the
@@ -335,6 +363,27 @@ void parallelogram_map(BITMAP *bmp, const BITMAP *spr, fixed xs[4], fixed ys[4])
 			// draw scanline
 			int r_bmp_x_i = (r_bmp_x_rounded >> 16);
 			int l_bmp_x_i = (l_bmp_x_rounded >> 16);
+			if (sameFormat && bmp_y_i >= 0 && bmp_y_i < bmp->h && l_bmp_x_i >= 0 && r_bmp_x_i < bmp->w) {
+				// The edge tests above keep the sprite coordinates inside the
+				// sprite, so the whole scanline can be drawn without per pixel
+				// bounds checks
+				switch (bmp->format.bytesPerPixel) {
+				case 1:
+					drawScanline<uint8>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, alphaMask, transColor);
+					goto skip_draw;
+				case 2:
+					drawScanline<uint16>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, alphaMask, transColor);
+					goto skip_draw;
+				case 4:
+					drawScanline<uint32>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, alphaMask, transColor);
+					goto skip_draw;
+				default:
+					break;
+				}
+			}
 			for (; l_bmp_x_i <= r_bmp_x_i; ++l_bmp_x_i) {
 				uint32 c = (uint32)getpixel(spr, l_spr_x_rounded >> 16, l_spr_y_rounded >> 16);
 				if ((c & alphaMask) != transColor) {
@@ -229,10 +229,15 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 	if (_spriteData[index].Image) {
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
+		_stats.Hits++;
 		return _spriteData[index].Image.get();
 	} else {
 		// Sprite exists in file but is not in mem, load it and add to MRU list
-		if (LoadSprite(index)) {
+		const uint32_t load_start = g_system->getMillis();
+		const size_t size = LoadSprite(index);
+		_stats.Misses++;
+		_stats.StallMs += g_system->getMillis() - load_start;
+		if (size) {
 			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
 			return _spriteData[index].Image.get();
 		}
@@ -331,6 +336,28 @@ void SpriteCache::PrecacheSprite(sprkey_t index) {
 	SprCacheLog("Precached %d", index);
 }
 
+bool SpriteCache::PrefetchSprite(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return false;
+	if (!_spriteData[index].IsAssetSprite() || _spriteData[index].IsError() ||
+		_spriteData[index].Image)
+		return false; // not an asset sprite, or already loaded
+
+	// Do not push out the sprites already in use for the sake of ones that
+	// may be needed; the final image format is only known after loading,
+	// so assume the largest one.
+	const size_t est_size = _sprInfos[index].Width * _sprInfos[index].Height * 4;
+	if (_cacheSize + est_size > _maxCacheSize)
+		return false;
+
+	if (LoadSprite(index) == 0)
+		return false;
+	_spriteData[index].MruIt = _mru.insert(_mru.end(), index);
+	_stats.Prefetches++;
+	SprCacheLog("Prefetched %d", index);
+	return true;
+}
+
 void SpriteCache::LockSprite(sprkey_t index) {
 	assert(index >= 0); // out of positive range indexes are valid to fail
 	if (index < 0 || (size_t)index >= _spriteData.size())
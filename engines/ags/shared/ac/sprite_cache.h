@@ -88,6 +88,14 @@ public:
 	typedef void (*PfnPostInitSprite)(sprkey_t index);
 	typedef void (*PfnPrewriteSprite)(Bitmap *image);
 
+	// Cache usage statistics, for diagnostic purposes
+	struct Stats {
+		uint32_t Hits = 0u;       // requested sprites which were already in memory
+		uint32_t Misses = 0u;     // requested sprites which had to be loaded
+		uint32_t Prefetches = 0u; // sprites loaded ahead of their use
+		uint32_t StallMs = 0u;    // time spent loading missed sprites
+	};
+
 	struct Callbacks {
 		PfnAdjustSpriteSize AdjustSize;
 		PfnInitSprite InitSprite;
@@ -138,6 +146,11 @@ public:
 	// Loads sprite using SpriteFile if such index is known,
 	// frees the space if cache size reaches the limit
 	void        PrecacheSprite(sprkey_t index);
+	// Loads sprite using SpriteFile ahead of its use, unless it's already loaded
+	// or the cache does not have enough free space for it; the prefetched sprite
+	// is put at the end of MRU list, and is the first to go if not used.
+	// Returns whether the sprite was loaded.
+	bool        PrefetchSprite(sprkey_t index);
 	// Locks sprite, preventing it from getting removed by the normal cache limit.
 	// If this is a registered sprite from the game assets, then loads it first.
 	// If this is a sprite with SPRCACHEFLAG_EXTERNAL flag, then does nothing,
@@ -174,6 +187,10 @@ public:
 	void        SetEmptySprite(sprkey_t index, bool as_asset);
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
+	// Returns cache usage statistics
+	const Stats &GetStats() const { return _stats; }
+	// Resets cache usage statistics
+	void        ResetStats() { _stats = Stats(); }
 
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Bitmap *operator[](sprkey_t index);
@@ -245,6 +262,7 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	Stats _stats;
 };
 
 } // namespace Shared
@@ -105,6 +105,63 @@ void Test_GfxSpeed(bool enableSimd, size_t blenderModeStart, size_t blenderModeE
 	if (!enableSimd) _G(simd_flags) = oldSimdFlags;
 }
 
+void Test_GfxRotateSpeed() {
+	Bitmap *sprites[] = {BitmapHelper::CreateBitmap(100, 100, 32), BitmapHelper::CreateBitmap(100, 100, 16), BitmapHelper::CreateBitmap(100, 100, 8)};
+	Bitmap *destinations[] = {BitmapHelper::CreateBitmap(200, 200, 32), BitmapHelper::CreateBitmap(200, 200, 16), BitmapHelper::CreateBitmap(200, 200, 8)};
+	const int benchRuns = 10000;
+	uint64 timeRotate = 0, timeAAStretch = 0;
+	for (int i = 0; i < 3; i++) {
+		uint32 start, end;
+		start = std::chrono::high_resolution_clock::now();
+		for (int run = 0; run < benchRuns; run++)
+			destinations[i]->RotateBlt(sprites[i], 100, 100, 50, 50, itofix(run % 256));
+		end = std::chrono::high_resolution_clock::now();
+		timeRotate += end - start;
+		start = std::chrono::high_resolution_clock::now();
+		for (int run = 0; run < benchRuns; run++)
+			destinations[i]->AAStretchBlt(sprites[i], RectWH(0, 0, 150 + run % 50, 150 + run % 50), kBitmap_Transparency);
+		end = std::chrono::high_resolution_clock::now();
+		timeAAStretch += end - start;
+	}
+
+	debug("Rotated blits over all pixel formats (%f) avg millis per call.", (double)timeRotate / (double)(benchRuns * 3));
+	debug("Anti-aliased stretched blits over all pixel formats (%f) avg millis per call.", (double)timeAAStretch / (double)(benchRuns * 3));
+
+	for (int i = 0; i < 3; i++) {
+		delete sprites[i];
+		delete destinations[i];
+	}
+}
+
+void Test_GfxRotate() {
+	// Rotating by zero degrees must copy every non transparent pixel as is,
+	// including for sprites which are partially outside of the destination
+	const int depths[] = {32, 16, 8};
+	for (int depth : depths) {
+		Bitmap *sprite = BitmapHelper::CreateBitmap(13, 9, depth);
+		for (int y = 0; y < sprite->GetHeight(); y++)
+			for (int x = 0; x < sprite->GetWidth(); x++)
+				sprite->PutPixel(x, y, ((x + y) % 4) ? 1 + ((x * 17 + y * 5) & 0x7f) : sprite->GetMaskColor());
+		Bitmap *dest = BitmapHelper::CreateBitmap(20, 20, depth);
+		const int positions[] = {-4, 3, 14};
+		for (int pos : positions) {
+			dest->Clear();
+			dest->RotateBlt(sprite, pos, pos, 0);
+			for (int y = 0; y < dest->GetHeight(); y++) {
+				for (int x = 0; x < dest->GetWidth(); x++) {
+					int expected = 0;
+					if (x >= pos && x < pos + sprite->GetWidth() && y >= pos && y < pos + sprite->GetHeight() &&
+							sprite->GetPixel(x - pos, y - pos) != (int)sprite->GetMaskColor())
+						expected = sprite->GetPixel(x - pos, y - pos);
+					assert(dest->GetPixel(x, y) == expected);
+				}
+			}
+		}
+		delete sprite;
+		delete dest;
+	}
+}
+
 void Test_BlenderModes() {
 	constexpr int depth = 2;
 	Graphics::ManagedSurface owner(16, 16, Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24));
@@ -265,11 +322,13 @@ void Test_GfxTransparency() {
 
 void Test_Gfx() {
 	Test_GfxTransparency();
+	Test_GfxRotate();
 #if (defined(SCUMMVM_AVX2) || defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)) && defined(SLOW_TESTS)
 	Test_BlenderModes();
 	// This could take a LONG time
 	Test_GfxSpeed(true, kSourceAlphaBlender, kTintLightBlenderMode);
 	Test_GfxSpeed(false, kSourceAlphaBlender, kTintLightBlenderMode);
+	Test_GfxRotateSpeed();
 #endif
 }
 
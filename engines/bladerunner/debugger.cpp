@@ -603,12 +603,15 @@ bool Debugger::cmdLoop(int argc, const char **argv) {
 		return true;
 	}
 
-	VQADecoder::LoopInfo &loopInfo = _vm->_scene->_vqaPlayer->_decoder._loopInfo;
+	VQAPlayer *vqaPlayer = _vm->_scene->_vqaPlayer;
+	VQADecoder::LoopInfo &loopInfo = vqaPlayer->_decoder._loopInfo;
 	if (argc == 1) {
 		debugPrintf("id start  end name\n");
 		for (int i = 0; i < loopInfo.loopCount; ++i) {
 			debugPrintf("%2d  %4d %4d %s\n", i, loopInfo.loops[i].begin, loopInfo.loops[i].end, loopInfo.loops[i].name.c_str());
 		}
+		debugPrintf("Frames shown: %u, missed deadline: %u\n", vqaPlayer->_framesShown, vqaPlayer->_framesMissedDeadline);
+		debugPrintf("Frames read ahead: %u, read on demand: %u\n", vqaPlayer->_decoder._prefetchHits, vqaPlayer->_decoder._prefetchMisses);
 		return true;
 	}
 
@@ -61,6 +61,12 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	_lineColorStamp = 0;
+	for (int i = 0; i < 256; ++i) {
+		_lineColors[i]      = 0;
+		_lineColorStamps[i] = 0;
+	}
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -537,6 +543,25 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+uint32 SliceRenderer::calculateSliceColor(const Color256 &paletteColor, const Color256 &aescColor) const {
+	Color256 color = paletteColor;
+	color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
+	color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
+	color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
+	// We need to convert from 5 bits per channel (r,g,b) to 8 bits
+	return _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
+}
+
+template<typename PixelType>
+static inline void drawSliceSpan(PixelType *dstLine, int maxX, uint16 *zbufferLine, int xStart, int xEnd, uint16 z, uint32 color) {
+	for (int x = xStart; x != xEnd; ++x) {
+		if (z < zbufferLine[x]) {
+			zbufferLine[x] = z;
+			dstLine[CLIP(x, 0, maxX)] = (PixelType)color;
+		}
+	}
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -544,6 +569,21 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// Without screen effects, the color of a vertex only depends on its
+	// palette index for the whole line
+	bool cacheColors = advanced && _screenEffects->_entries.empty();
+	if (cacheColors) {
+		if (++_lineColorStamp == 0) {
+			for (int i = 0; i < 256; ++i) {
+				_lineColorStamps[i] = 0;
+			}
+			_lineColorStamp = 1;
+		}
+	}
+
+	void *dstLine = surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	int maxX = surface.w - 1;
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -573,25 +613,31 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
 					uint32 outColor = palette.value[p[2]];
-					if (advanced) {
+					if (cacheColors) {
+						if (_lineColorStamps[p[2]] != _lineColorStamp) {
+							static const Color256 noColor = { 0, 0, 0 };
+							_lineColors[p[2]] = calculateSliceColor(palette.color[p[2]], noColor);
+							_lineColorStamps[p[2]] = _lineColorStamp;
+						}
+						outColor = _lineColors[p[2]];
+					} else if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
 						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
-						// We need to convert from 5 bits per channel (r,g,b) to 8 bits
-						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
+						outColor = calculateSliceColor(palette.color[p[2]], aescColor);
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
-						}
+					switch (surface.format.bytesPerPixel) {
+					case 1:
+						drawSliceSpan<uint8>((uint8 *)dstLine, maxX, zbufferLine, previousVertexX, vertexX, (uint16)vertexZ, outColor);
+						break;
+					case 2:
+						drawSliceSpan<uint16>((uint16 *)dstLine, maxX, zbufferLine, previousVertexX, vertexX, (uint16)vertexZ, outColor);
+						break;
+					case 4:
+						drawSliceSpan<uint32>((uint32 *)dstLine, maxX, zbufferLine, previousVertexX, vertexX, (uint16)vertexZ, outColor);
+						break;
+					default:
+						break;
 					}
 				}
 			}
@@ -88,6 +88,13 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Lit palette colors of the current slice line, valid when their
+	// stamp matches _lineColorStamp. Only used when no screen effect
+	// can change the color of individual pixels.
+	uint32 _lineColors[256];
+	uint32 _lineColorStamps[256];
+	uint32 _lineColorStamp;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -114,6 +121,7 @@ private:
 	void loadFrame(int animation, int frame);
 
 	void drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine);
+	uint32 calculateSliceColor(const Color256 &paletteColor, const Color256 &aescColor) const;
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
@@ -138,6 +138,15 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+	_nextPrefetchedFrame = 0;
+	_prefetchHits        = 0;
+	_prefetchMisses      = 0;
+	for (int i = 0; i < kPrefetchedFramesCount; ++i) {
+		_prefetchedFrames[i].frame    = -1;
+		_prefetchedFrames[i].size     = 0;
+		_prefetchedFrames[i].capacity = 0;
+		_prefetchedFrames[i].data     = nullptr;
+	}
 	_vqpPalsArr          = nullptr;
 	_numOfVQPPalettes    = 0;
 	_oldV2VQA                 = false;
@@ -166,6 +175,8 @@ void VQADecoder::close() {
 	delete[] _frameInfo;
 	_frameInfo = nullptr;
 
+	clearPrefetchedFrames();
+
 	_loopInfo.close();
 
 	deleteVQPTable();
@@ -296,13 +307,97 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 		error("VQADecoder::readFrame(): frame %d out of bounds, frame count is %d", frame, numFrames());
 	}
 
+	_readingFrame = frame;
+
+	int slot = findPrefetchedFrame(frame);
+	if (slot >= 0) {
+		++_prefetchHits;
+
+		Common::MemoryReadStream frameStream(_prefetchedFrames[slot].data, _prefetchedFrames[slot].size);
+		Common::SeekableReadStream *fileStream = _s;
+		_s = &frameStream;
+		readPacket(readFlags);
+		_s = fileStream;
+		return;
+	}
+
+	++_prefetchMisses;
+
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
 	_s->seek(frameOffset);
 
-	_readingFrame = frame;
 	readPacket(readFlags);
 }
 
+int VQADecoder::findPrefetchedFrame(int frame) const {
+	for (int i = 0; i < kPrefetchedFramesCount; ++i) {
+		if (_prefetchedFrames[i].frame == frame) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+bool VQADecoder::isFramePrefetched(int frame) const {
+	return findPrefetchedFrame(frame) >= 0;
+}
+
+bool VQADecoder::prefetchFrame(int frame) {
+	if (!_s || !_frameInfo || frame < 0 || frame >= numFrames()) {
+		return false;
+	}
+
+	if (findPrefetchedFrame(frame) >= 0) {
+		return true;
+	}
+
+	// A frame packet spans up to the start of the next one
+	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	uint32 frameEnd;
+	if (frame + 1 < numFrames()) {
+		frameEnd = 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF);
+	} else {
+		frameEnd = _s->size();
+	}
+
+	if (frameEnd <= frameOffset || frameEnd - frameOffset > kMaxPrefetchedFrameSize) {
+		return false;
+	}
+
+	PrefetchedFrame &prefetched = _prefetchedFrames[_nextPrefetchedFrame];
+	_nextPrefetchedFrame = (_nextPrefetchedFrame + 1) % kPrefetchedFramesCount;
+
+	uint32 size = frameEnd - frameOffset;
+	if (prefetched.capacity < size) {
+		delete[] prefetched.data;
+		prefetched.data = new uint8[size];
+		prefetched.capacity = size;
+	}
+
+	_s->seek(frameOffset);
+	if (_s->read(prefetched.data, size) != size) {
+		prefetched.frame = -1;
+		return false;
+	}
+
+	prefetched.frame = frame;
+	prefetched.size  = size;
+	return true;
+}
+
+void VQADecoder::clearPrefetchedFrames() {
+	for (int i = 0; i < kPrefetchedFramesCount; ++i) {
+		delete[] _prefetchedFrames[i].data;
+		_prefetchedFrames[i].frame    = -1;
+		_prefetchedFrames[i].size     = 0;
+		_prefetchedFrames[i].capacity = 0;
+		_prefetchedFrames[i].data     = nullptr;
+	}
+	_nextPrefetchedFrame = 0;
+	_prefetchHits        = 0;
+	_prefetchMisses      = 0;
+}
+
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
 	if (size != 42)
 		return false;
@@ -68,6 +68,9 @@ public:
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
+	bool isFramePrefetched(int frame) const;
+	bool prefetchFrame(int frame);
+
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
@@ -177,6 +180,23 @@ public:
 
 	uint32  *_frameInfo;
 
+	// Ring of frame packets read ahead of time, so readFrame() can parse
+	// the frame due next from memory instead of seeking in the file
+	static const int    kPrefetchedFramesCount = 8;
+	static const uint32 kMaxPrefetchedFrameSize = 1024 * 1024;
+
+	struct PrefetchedFrame {
+		int     frame;
+		uint32  size;
+		uint32  capacity;
+		uint8  *data;
+	};
+
+	PrefetchedFrame _prefetchedFrames[kPrefetchedFramesCount];
+	int             _nextPrefetchedFrame;
+	uint32          _prefetchHits;
+	uint32          _prefetchMisses;
+
 	uint32   _maxVIEWChunkSize;
 	uint32   _maxZBUFChunkSize;
 	uint32   _maxAESCChunkSize;
@@ -197,6 +217,9 @@ public:
 
 	CodebookInfo &codebookInfoForFrame(int frame);
 
+	int  findPrefetchedFrame(int frame) const;
+	void clearPrefetchedFrames();
+
 	class VQAVideoTrack {
 		static const uint     kSizeInBytesOfCPL0Chunk = 768; // 3 * 256
 	public:
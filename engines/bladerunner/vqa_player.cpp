@@ -91,6 +91,8 @@ bool VQAPlayer::open() {
 	_repeatsCount = 0;
 	_loopIdTarget = -1;
 	_frame = -1;
+	_framesShown = 0;
+	_framesMissedDeadline = 0;
 	_frameBeginNext = -1;
 	_frameEnd = getFrameCount() - 1;
 	_frameEndQueued = -1;
@@ -276,7 +278,17 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 		// Note, we use unsigned difference to avoid potential time overflow issues
 		result = -1;
 
+		// Use the spare time to read the upcoming frames
+		if (advanceFrame) {
+			prefetchFrames();
+		}
+
 	} else if (advanceFrame) {
+		if (useTime && _frame != -1 && now - _frameNextTime >= kVqaFrameTimeDiff) {
+			++_framesMissedDeadline;
+		}
+		++_framesShown;
+
 		_frame = _frameNext;
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
 		_decoder.decodeVideoFrame(customSurface != nullptr ? customSurface : _surface, _frameNext);
@@ -363,6 +375,34 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 	               // assert(frame >= -1) in overlay modes (elevator, scores, spinner)
 }
 
+void VQAPlayer::prefetchFrames() {
+	// Follow the playback order, including the jump back to the
+	// beginning of the loop (or to the queued loop)
+	int frame = _frameNext;
+	int frameEnd = _frameEnd;
+	bool wrapped = false;
+
+	for (int i = 0; i < kMaxVideoPrefetchedFrames; ++i) {
+		if (frame > frameEnd) {
+			if (wrapped || _frameBeginNext < 0 || (_repeatsCount == 0 && _frameEndQueued == -1)) {
+				return;
+			}
+			frame = _frameBeginNext;
+			if (_frameEndQueued != -1) {
+				frameEnd = _frameEndQueued;
+			}
+			wrapped = true;
+		}
+
+		if (!_decoder.isFramePrefetched(frame)) {
+			// Read a single frame per call, so that we don't stall the engine
+			_decoder.prefetchFrame(frame);
+			return;
+		}
+		++frame;
+	}
+}
+
 void VQAPlayer::updateZBuffer(ZBuffer *zbuffer) {
 	_decoder.decodeZBuffer(zbuffer);
 #if !BLADERUNNER_ORIGINAL_BUGS
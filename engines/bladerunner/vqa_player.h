@@ -55,6 +55,7 @@ class VQAPlayer {
 
 	static const uint32  kVqaFrameTimeDiff             = 4000; // 60 * 1000 / 15
 	static const int     kMaxAudioPreloadedFrames      = 15;
+	static const int     kMaxVideoPrefetchedFrames     = 4;
 	// Use speech sound type as in original engine
 	static const Audio::Mixer::SoundType kVQASoundType = Audio::Mixer::kSpeechSoundType;
 
@@ -82,6 +83,8 @@ class VQAPlayer {
 	int _repeatsCountInitial;
 
 	uint32 _frameNextTime;
+	uint32 _framesShown;
+	uint32 _framesMissedDeadline; // frames shown more than a frame period after they were due
 	bool   _hasAudio;
 	bool   _audioStarted;
 	Audio::SoundHandle _soundHandle;
@@ -113,6 +116,8 @@ public:
 		  _loopIdInitial(-1),
 		  _repeatsCountInitial(-1),
 		  _frameNextTime(0),
+		  _framesShown(0),
+		  _framesMissedDeadline(0),
 		  _hasAudio(false),
 		  _audioStarted(false),
 		  _specialPS15GlitchFix(false),
@@ -152,6 +157,7 @@ public:
 
 private:
 	void queueAudioFrame(Audio::AudioStream *audioStream);
+	void prefetchFrames();
 };
 
 } // End of namespace BladeRunner
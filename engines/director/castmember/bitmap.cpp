@@ -48,6 +48,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableRe
 	_picture = new Picture();
 	_ditheredImg = nullptr;
 	_matte = nullptr;
+	_matteVersion = 0;
 	_noMatte = false;
 	_bytes = 0;
 	_pitch = 0;
@@ -168,6 +169,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Image::ImageDecode
 	: CastMember(cast, castId) {
 	_type = kCastBitmap;
 	_matte = nullptr;
+	_matteVersion = 0;
 	_noMatte = false;
 	_bytes = 0;
 	if (img != nullptr) {
@@ -202,6 +204,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, BitmapCastMember &
 	_picture = source._picture ? new Picture(*source._picture) : nullptr;
 	_ditheredImg = nullptr;
 	_matte = nullptr;
+	_matteVersion = 0;
 
 	_pitch = source._pitch;
 	_regX = source._regX;
@@ -525,6 +528,7 @@ void BitmapCastMember::createMatte(const Common::Rect &bbox) {
 				_matte->setPixel(x, y, matteSurf->getPixel(x, y) ? 0x00 : 0xff);
 			}
 		}
+		_matteVersion = g_director->newMatteVersion();
 		_noMatte = false;
 	}
 
@@ -73,6 +73,7 @@ public:
 	Picture *_picture = nullptr;
 	Graphics::Surface *_ditheredImg;
 	Graphics::Surface *_matte;
+	uint32 _matteVersion;
 
 	uint16 _pitch;
 	int16 _regX;
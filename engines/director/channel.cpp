@@ -87,6 +87,9 @@ Channel& Channel::operator=(const Channel &channel) {
 	_visible = channel._visible;
 	_dirty = channel._dirty;
 
+	// The copy has no widget of its own, so it can't share the ink layer
+	freeInkLayer();
+
 	return *this;
 }
 
@@ -103,6 +106,8 @@ Channel::~Channel() {
 		delete _mask;
 	if (_sprite)
 		delete _sprite;
+
+	freeInkLayer();
 }
 
 DirectorPlotData Channel::getPlotData() {
@@ -129,6 +134,66 @@ DirectorPlotData Channel::getPlotData() {
 	return pd;
 }
 
+bool Channel::getInkLayer(DirectorPlotData &pd, const Graphics::Surface *mask, InkLayer *&layer) {
+	// Only bitmaps are cached, as their widget surfaces only change
+	// when the widget gets replaced. The mask ink gets a freshly copied
+	// mask surface on every blit, so there is nothing to key its layer on.
+	if (!pd.canCacheInk() || pd.ink == kInkTypeMask || !_sprite->_cast || _sprite->_cast->_type != kCastBitmap || isActiveVideo())
+		return false;
+
+	// Any other mask is the matte of the sprite's own bitmap
+	uint32 matteVersion = mask ? ((BitmapCastMember *)_sprite->_cast)->_matteVersion : 0;
+
+	bool stale = !_inkLayer.surface || _inkLayer.dirty ||
+		_inkLayer.source != pd.srf ||
+		_inkLayer.matteId != _sprite->_castId ||
+		_inkLayer.matteVersion != matteVersion ||
+		_inkLayer.ink != pd.ink ||
+		_inkLayer.foreColor != pd.foreColor ||
+		_inkLayer.backColor != pd.backColor ||
+		_inkLayer.surface->w != pd.srf->w ||
+		_inkLayer.surface->h != pd.srf->h;
+
+	// Palette indices don't change meaning, but true color pixels do
+	if (g_director->_pixelformat.bytesPerPixel != 1 && _inkLayer.paletteVersion != g_director->getPaletteVersion())
+		stale = true;
+
+	if (stale) {
+		if (!_inkLayer.surface || _inkLayer.surface->w != pd.srf->w || _inkLayer.surface->h != pd.srf->h) {
+			freeInkLayer();
+			_inkLayer.surface = new Graphics::ManagedSurface(pd.srf->w, pd.srf->h, g_director->_pixelformat);
+			_inkLayer.coverage = new Graphics::ManagedSurface(pd.srf->w, pd.srf->h, Graphics::PixelFormat::createFormatCLUT8());
+		}
+
+		pd.buildInkLayer(mask, _inkLayer.surface, _inkLayer.coverage);
+
+		_inkLayer.source = pd.srf;
+		_inkLayer.matteId = _sprite->_castId;
+		_inkLayer.matteVersion = matteVersion;
+		_inkLayer.ink = pd.ink;
+		_inkLayer.foreColor = pd.foreColor;
+		_inkLayer.backColor = pd.backColor;
+		_inkLayer.paletteVersion = g_director->getPaletteVersion();
+		_inkLayer.dirty = false;
+
+		debugC(8, kDebugImages, "Channel::getInkLayer(): rebuilt %dx%d layer for cast %s, ink %d",
+			pd.srf->w, pd.srf->h, _sprite->_castId.asString().c_str(), pd.ink);
+	}
+
+	layer = &_inkLayer;
+	return true;
+}
+
+void Channel::invalidateInkLayer() {
+	_inkLayer.dirty = true;
+}
+
+void Channel::freeInkLayer() {
+	delete _inkLayer.surface;
+	delete _inkLayer.coverage;
+	_inkLayer = InkLayer();
+}
+
 Graphics::ManagedSurface *Channel::getSurface() {
 	if (_widget) {
 		return _widget->getSurface();
@@ -398,6 +463,7 @@ void Channel::setCast(CastMemberID memberID) {
 	// those custom dimensions to stick around.
 	_sprite->setCast(memberID, !_sprite->_stretch);
 	replaceWidget();
+	invalidateInkLayer();
 
 	// Based on Director in a Nutshell, page 15
 	_sprite->setAutoPuppet(kAPCast, true);
@@ -635,6 +701,8 @@ void Channel::replaceWidget(CastMemberID previousCastId, bool force) {
 		_widget = nullptr;
 	}
 
+	invalidateInkLayer();
+
 	if (_sprite && _sprite->_cast) {
 		// use sprite type to guide us how to draw the cast
 		// if the type don't match, then we will set it as transparent. i.e. don't create widget
@@ -671,6 +739,7 @@ bool Channel::updateWidget() {
 			_sprite->_cast->updateFromWidget(_widget, _sprite->_editable);
 		}
 		_widget->draw();
+		invalidateInkLayer();
 		return true;
 	}
 
@@ -37,6 +37,23 @@ class Sprite;
 class Cursor;
 class Score;
 
+// The sprite with its ink already applied, for inks which don't depend
+// on what's underneath. Pixels not set in coverage are left untouched.
+struct InkLayer {
+	Graphics::ManagedSurface *surface = nullptr;
+	Graphics::ManagedSurface *coverage = nullptr;
+
+	// What the layer was built from
+	const Graphics::ManagedSurface *source = nullptr;
+	CastMemberID matteId;
+	uint32 matteVersion = 0;
+	InkType ink = kInkTypeCopy;
+	uint32 foreColor = 0;
+	uint32 backColor = 0;
+	uint32 paletteVersion = 0;
+	bool dirty = true;
+};
+
 class Channel {
 public:
 	Channel(Score *sc, Sprite *sp, int priority = 0);
@@ -46,6 +63,8 @@ public:
 
 	DirectorPlotData getPlotData();
 	const Graphics::Surface *getMask(bool forceMatte = false);
+	bool getInkLayer(DirectorPlotData &pd, const Graphics::Surface *mask, InkLayer *&layer);
+	void invalidateInkLayer();
 
 	inline int getWidth() { return _sprite->_width; };
 	inline int getHeight() { return _sprite->_height; };
@@ -121,7 +140,9 @@ public:
 
 private:
 	Graphics::ManagedSurface *getSurface();
+	void freeInkLayer();
 	Score *_score;
+	InkLayer _inkLayer;
 };
 
 } // End of namespace Director
@@ -288,6 +288,8 @@ bool Debugger::cmdInfo(int argc, const char **argv) {
 	debugPrintf("Allow outdated Lingo flag: %d\n", movie->_allowOutdatedLingo);
 	debugPrintf("Frame count: %d\n", score->getFramesNum());
 	debugPrintf("Cast member count: %d\n", cast->getCastSize());
+	debugPrintf("Lingo scripts compiled: %d (%d from parse cache) in %d ms\n", movie->_lingoScriptsCompiled, movie->_lingoScriptsParseCached, movie->_lingoCompileTime);
+	debugPrintf("Lingo execution time: %d ms\n", movie->_lingoExecTime);
 	debugPrintf("Search paths:\n");
 	if (g_lingo->_searchPath.isArray() && g_lingo->_searchPath.u.farr->arr.size() > 0) {
 		for (auto &it : g_lingo->_searchPath.u.farr->arr) {
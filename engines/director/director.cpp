@@ -82,6 +82,8 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 
 	memset(_currentPalette, 0, 768);
 	_currentPaletteLength = 0;
+	_currentPaletteVersion = 0;
+	_matteVersion = 0;
 	_stage = nullptr;
 	_mainArchive = nullptr;
 	_currentWindow = nullptr;
@@ -211,6 +211,9 @@ public:
 	const Common::FSNode *getGameDataDir() const { return &_gameDataDir; }
 	const byte *getPalette() const { return _currentPalette; }
 	uint16 getPaletteColorCount() const { return _currentPaletteLength; }
+	uint32 getPaletteVersion() const { return _currentPaletteVersion; }
+	// Unique stamp for every matte built, so ink layers can tell them apart
+	uint32 newMatteVersion() { return ++_matteVersion; }
 
 	void loadPatterns();
 	Picture *getTile(int num);
@@ -307,6 +310,8 @@ public:
 private:
 	byte _currentPalette[768];
 	uint16 _currentPaletteLength;
+	uint32 _currentPaletteVersion;
+	uint32 _matteVersion;
 	bool _gammaCorrection;
 	Lingo *_lingo;
 	uint16 _version;
@@ -370,6 +375,9 @@ struct DirectorPlotData {
 	uint32 preprocessColor(uint32 src);
 	void inkBlitShape(Common::Rect &srcRect);
 	void inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask);
+	bool canCacheInk() const;
+	void buildInkLayer(const Graphics::Surface *mask, Graphics::ManagedSurface *layer, Graphics::ManagedSurface *coverage);
+	void inkBlitLayer(Common::Rect &srcRect, const Graphics::ManagedSurface *layer, const Graphics::ManagedSurface *coverage);
 
 	DirectorPlotData(DirectorEngine *d_, SpriteType s, InkType i, int a, uint32 b, uint32 f) : d(d_), sprite(s), ink(i), alpha(a), backColor(b), foreColor(f) {
 		colorWhite = d->_wm->_colorWhite;
@@ -230,6 +230,9 @@ void DirectorEngine::shiftPalette(int startIndex, int endIndex, bool reverse) {
 }
 
 void DirectorEngine::syncPalette() {
+	// Lets cached ink layers know that their colors may be stale
+	_currentPaletteVersion++;
+
 	byte paletteBuf[768];
 	if (_gammaCorrection) {
 		for (size_t i = 0; i < (size_t)_currentPaletteLength*3; i++) {
@@ -768,4 +771,81 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 
 }
 
+bool DirectorPlotData::canCacheInk() const {
+	// Only inks which either copy the (preprocessed) source pixel or leave
+	// the destination alone can be applied ahead of time
+	if (!srf || ms || alpha || applyColor || oneBitImage)
+		return false;
+
+	switch (ink) {
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBlend:
+	case kInkTypeBackgndTrans:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <typename T>
+static void buildInkLayerRows(DirectorPlotData *p, const Graphics::Surface *mask, Graphics::ManagedSurface *layer, Graphics::ManagedSurface *coverage) {
+	for (int y = 0; y < p->srf->h; y++) {
+		const T *src = (const T *)p->srf->getBasePtr(0, y);
+		const byte *msk = (mask && y < mask->h) ? (const byte *)mask->getBasePtr(0, y) : nullptr;
+		T *out = (T *)layer->getBasePtr(0, y);
+		byte *cov = (byte *)coverage->getBasePtr(0, y);
+
+		for (int x = 0; x < p->srf->w; x++) {
+			uint32 color = p->preprocessColor(src[x]);
+			bool visible = !mask || (msk && x < mask->w && msk[x]);
+
+			if (p->ink == kInkTypeBackgndTrans && color == p->backColor)
+				visible = false;
+
+			out[x] = color;
+			cov[x] = visible ? 1 : 0;
+		}
+	}
+}
+
+void DirectorPlotData::buildInkLayer(const Graphics::Surface *mask, Graphics::ManagedSurface *layer, Graphics::ManagedSurface *coverage) {
+	if (d->_wm->_pixelformat.bytesPerPixel == 1)
+		buildInkLayerRows<byte>(this, mask, layer, coverage);
+	else
+		buildInkLayerRows<uint32>(this, mask, layer, coverage);
+}
+
+template <typename T>
+static void inkBlitLayerRows(Graphics::ManagedSurface *dst, const Common::Rect &destRect, const Common::Point &srcPos, const Graphics::ManagedSurface *layer, const Graphics::ManagedSurface *coverage) {
+	for (int y = 0; y < destRect.height(); y++) {
+		const T *src = (const T *)layer->getBasePtr(srcPos.x, srcPos.y + y);
+		const byte *cov = (const byte *)coverage->getBasePtr(srcPos.x, srcPos.y + y);
+		T *out = (T *)dst->getBasePtr(destRect.left, destRect.top + y);
+
+		for (int x = 0; x < destRect.width(); x++) {
+			if (cov[x])
+				out[x] = src[x];
+		}
+	}
+}
+
+void DirectorPlotData::inkBlitLayer(Common::Rect &srcRect, const Graphics::ManagedSurface *layer, const Graphics::ManagedSurface *coverage) {
+	// Same clipping as inkBlitSurface, minus the per-pixel bounds check
+	Common::Rect layerRect(layer->w, layer->h);
+	layerRect.translate(srcRect.left, srcRect.top);
+
+	Common::Rect blitRect = destRect;
+	blitRect.clip(layerRect);
+	if (blitRect.isEmpty())
+		return;
+
+	Common::Point srcPos(blitRect.left - srcRect.left, blitRect.top - srcRect.top);
+
+	if (d->_wm->_pixelformat.bytesPerPixel == 1)
+		inkBlitLayerRows<byte>(dst, blitRect, srcPos, layer, coverage);
+	else
+		inkBlitLayerRows<uint32>(dst, blitRect, srcPos, layer, coverage);
+}
+
 } // End of namespace Director
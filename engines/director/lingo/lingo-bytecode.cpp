@@ -1684,6 +1684,7 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 					_assemblyArchive->functionHandlers[it._key] = it._value;
 				}
 			}
+			Lingo::invalidateHandlerCache();
 		}
 	}
 
@@ -1701,11 +1702,19 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 }
 
 void LingoArchive::addCodeV4(Common::SeekableReadStreamEndian &stream, uint16 lctxIndex, const Common::String &archName, uint16 version) {
+	uint32 startTime = g_system->getMillis();
+
 	ScriptContext *ctx = g_lingo->_compiler->compileLingoV4(stream, lctxIndex, this, archName, version);
 	if (ctx) {
 		lctxContexts[lctxIndex] = ctx;
 		ctx->incRefCount();
 	}
+
+	Movie *movie = cast->getMovie();
+	if (movie) {
+		movie->_lingoCompileTime += g_system->getMillis() - startTime;
+		movie->_lingoScriptsCompiled++;
+	}
 }
 
 void LingoArchive::addNamesV4(Common::SeekableReadStreamEndian &stream) {
@@ -1566,22 +1566,22 @@ void LC::c_telldone() {
 //************************
 
 void LC::c_callcmd() {
-	Common::String name(g_lingo->readString());
+	HandlerCallSite &site = g_lingo->getCallSite(g_lingo->readString());
 
 	int nargs = g_lingo->readInt();
 
-	LC::call(name, nargs, false);
+	LC::call(site.name, nargs, false, &site);
 }
 
 void LC::c_callfunc() {
-	Common::String name(g_lingo->readString());
+	HandlerCallSite &site = g_lingo->getCallSite(g_lingo->readString());
 
 	int nargs = g_lingo->readInt();
 
-	LC::call(name, nargs, true);
+	LC::call(site.name, nargs, true, &site);
 }
 
-void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
+void LC::call(const Common::String &name, int nargs, bool allowRetVal, HandlerCallSite *callSite) {
 	if (debugChannelSet(3, kDebugLingoExec))
 		g_lingo->printArgs(name.c_str(), nargs, "call:");
 
@@ -1647,7 +1647,7 @@ void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
 	}
 
 	// Handler
-	funcSym = g_lingo->getHandler(name);
+	funcSym = g_lingo->getHandler(name, callSite);
 
 	if (g_lingo->_builtinListHandlers.contains(name) && nargs >= 1) {
 		// Lingo builtin functions in the "List" category have very strange override mechanics.
@@ -24,6 +24,8 @@
 
 namespace Director {
 
+struct HandlerCallSite;
+
 namespace LC {
 
 void c_xpop();
@@ -124,7 +126,7 @@ void c_callcmd();
 void c_callfunc();
 
 void call(const Symbol &targetSym, int nargs, bool allowRetVal);
-void call(const Common::String &name, int nargs, bool allowRetVal);
+void call(const Common::String &name, int nargs, bool allowRetVal, HandlerCallSite *callSite = nullptr);
 
 void c_procret();
 void procret();
@@ -45,6 +45,7 @@
 #include "common/endian.h"
 
 #include "director/director.h"
+#include "director/cast.h"
 #include "director/movie.h"
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-ast.h"
@@ -139,34 +140,69 @@ ScriptContext *LingoCompiler::compileLingo(const Common::U32String &code, LingoA
 	_linenumber = _colnumber = 1;
 	_hadError = false;
 
-	// Preprocess the code for ease of the parser
-	Common::U32String codePrep = codePreprocessor(code, archive, type, id, preprocFlags);
-
-	// Search the methods
-	mainContext->_methodNames = prescanMethods(codePrep);
+	// Scripts which are compiled again (e.g. a shared cast reloaded by
+	// the next movie) reuse the AST from the previous parse. Code
+	// generation is still run, as it registers factories and globals.
+	Common::String parseKey;
+	if (archive && archive->cast && !anonymous) {
+		parseKey = Common::String::format("%s:%d:%d:%d:%x:%x", archive->cast->getMacName().c_str(),
+				type, id.castLib, id.member, preprocFlags, Common::Hash<Common::U32String>()(code));
+	}
+
+	bool parseCached = false;
+	if (!parseKey.empty() && _parsedScripts.contains(parseKey)) {
+		ParsedScript &parsed = _parsedScripts[parseKey];
+		if (parsed.code == code) {
+			mainContext->_methodNames = parsed.methodNames;
+			_assemblyAST = parsed.ast;
+			parseCached = true;
+			_parseCacheHits++;
+			debugC(2, kDebugCompile, "compileLingo(): reusing parsed script %s", parseKey.c_str());
+		}
+	}
 
-	Common::String codeNorm = codePrep.encode(Common::kUtf8);
-	const char *utf8Code = codeNorm.c_str();
+	if (!parseCached) {
+		// Preprocess the code for ease of the parser
+		Common::U32String codePrep = codePreprocessor(code, archive, type, id, preprocFlags);
 
-	// Parse the Lingo and build an AST
-	parse(utf8Code);
-	// If it doesn't work, and we have kLPPTrimGarbage enabled,
-	// have another try with the input trimmed to the last valid character.
-	if (!_assemblyAST && (preprocFlags & kLPPTrimGarbage)) {
-		delete _assemblyContext;
-		delete _currentAssembly;
-		delete _methodVars;
-		_assemblyId = id.member;
-		mainContext = _assemblyContext = new ScriptContext(scriptName, type, _assemblyId);
-		_currentAssembly = new ScriptData;
-		_methodVars = new VarTypeHash;
+		// Search the methods
 		mainContext->_methodNames = prescanMethods(codePrep);
-		_linenumber = _colnumber = 1;
-		_hadError = false;
-		codeNorm = codeNorm.substr(0, _bytenumber - 1) + "\n";
-		utf8Code = codeNorm.c_str();
+
+		Common::String codeNorm = codePrep.encode(Common::kUtf8);
+		const char *utf8Code = codeNorm.c_str();
+
+		// Parse the Lingo and build an AST
 		parse(utf8Code);
+		// If it doesn't work, and we have kLPPTrimGarbage enabled,
+		// have another try with the input trimmed to the last valid character.
+		if (!_assemblyAST && (preprocFlags & kLPPTrimGarbage)) {
+			delete _assemblyContext;
+			delete _currentAssembly;
+			delete _methodVars;
+			_assemblyId = id.member;
+			mainContext = _assemblyContext = new ScriptContext(scriptName, type, _assemblyId);
+			_currentAssembly = new ScriptData;
+			_methodVars = new VarTypeHash;
+			mainContext->_methodNames = prescanMethods(codePrep);
+			_linenumber = _colnumber = 1;
+			_hadError = false;
+			codeNorm = codeNorm.substr(0, _bytenumber - 1) + "\n";
+			utf8Code = codeNorm.c_str();
+			parse(utf8Code);
+		}
+
+		if (_assemblyAST && !parseKey.empty()) {
+			// Keep the cache bounded, it is only there to speed up reloads
+			if (_parsedScripts.size() >= kMaxParsedScripts)
+				_parsedScripts.clear();
+
+			ParsedScript &parsed = _parsedScripts[parseKey];
+			parsed.code = code;
+			parsed.methodNames = mainContext->_methodNames;
+			parsed.ast = _assemblyAST;
+		}
 	}
+
 	if (!_assemblyAST) {
 		delete _assemblyContext;
 		delete _currentAssembly;
@@ -253,6 +289,7 @@ ScriptContext *LingoCompiler::compileLingo(const Common::U32String &code, LingoA
 				_assemblyArchive->functionHandlers[it._key] = it._value;
 			}
 		}
+		Lingo::invalidateHandlerCache();
 	}
 
 	delete _methodVars;
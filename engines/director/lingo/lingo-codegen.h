@@ -71,6 +71,18 @@ public:
 
 	bool _hadError;
 
+	struct ParsedScript {
+		Common::U32String code;
+		MethodHash methodNames;
+		Common::SharedPtr<Node> ast;
+	};
+
+	static const uint kMaxParsedScripts = 2048;
+	Common::HashMap<Common::String, ParsedScript> _parsedScripts;
+
+public:
+	uint32 _parseCacheHits = 0;
+
 public:
 	virtual bool visitScriptNode(ScriptNode *node);
 	virtual bool visitFactoryNode(FactoryNode *node);
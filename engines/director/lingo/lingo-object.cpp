@@ -471,12 +471,14 @@ void LM::m_dispose(int nargs) {
 
 /* ScriptContext */
 
+uint32 ScriptContext::_nextSerial = 0;
+
 ScriptContext::ScriptContext(Common::String name, ScriptType type, int id, uint16 castLibHint)
-	: Object<ScriptContext>(name), _scriptType(type), _id(id), _castLibHint(castLibHint) {
+	: Object<ScriptContext>(name), _scriptType(type), _id(id), _castLibHint(castLibHint), _serial(++_nextSerial) {
 	_objType = kScriptObj;
 }
 
-ScriptContext::ScriptContext(const ScriptContext &sc) : Object<ScriptContext>(sc) {
+ScriptContext::ScriptContext(const ScriptContext &sc) : Object<ScriptContext>(sc), _serial(++_nextSerial) {
 	_scriptType = sc._scriptType;
 	_functionNames = sc._functionNames;
 	for (auto &it : sc._functionHandlers) {
@@ -519,6 +521,7 @@ Symbol ScriptContext::define(const Common::String &name, ScriptData *code, Commo
 	}
 
 	_functionHandlers[name] = sym;
+	Lingo::invalidateHandlerCache();
 	if (g_lingo->_eventHandlerTypeIds.contains(name)) {
 		_eventHandlers[g_lingo->_eventHandlerTypeIds[name]] = sym;
 	}
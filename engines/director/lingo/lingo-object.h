@@ -223,8 +223,11 @@ public:
 	Common::HashMap<uint32, Datum> _objArray;
 	MethodHash _methodNames;
 	Common::SharedPtr<Node> _assemblyAST;	// Optionally contains AST when we compile Lingo
+	uint32 _serial;	// unlike the address, never reused by another context
 
 private:
+	static uint32 _nextSerial;
+
 	DatumHash _properties;
 	Common::Array<Common::String> _propertyNames;
 	bool _onlyInLctxContexts = false;
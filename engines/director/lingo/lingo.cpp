@@ -45,6 +45,8 @@ namespace Director {
 
 Lingo *g_lingo;
 
+uint32 Lingo::_handlerCacheGeneration = 0;
+
 int calcStringAlignment(const char *s) {
 	return calcCodeAlignment(strlen(s) + 1);
 }
@@ -176,6 +178,7 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 	_state = nullptr;
 	_currentChannelId = -1;
 	_globalCounter = 0;
+	_callSitesGeneration = 0;
 	_freezeState = false;
 	_freezePlay = false;
 	_playDone = false;
@@ -269,6 +272,8 @@ LingoArchive::~LingoArchive() {
 		}
 		delete it._value;
 	}
+
+	Lingo::invalidateHandlerCache();
 }
 
 ScriptContext *LingoArchive::getScriptContext(ScriptType type, uint16 id) {
@@ -332,19 +337,62 @@ Common::String LingoArchive::formatFunctionList(const char *prefix) {
 	return result;
 }
 
-Symbol Lingo::getHandler(const Common::String &name) {
+HandlerCallSite &Lingo::getCallSite(const char *code) {
+	// Handler tables changed, or scripts went away and their code may be
+	// reused for different calls: forget all of them
+	if (_callSitesGeneration != _handlerCacheGeneration) {
+		_callSites.clear();
+		_callSitesGeneration = _handlerCacheGeneration;
+	}
+
+	Common::HashMap<const void *, HandlerCallSite>::iterator it = _callSites.find(code);
+	if (it != _callSites.end())
+		return it->_value;
+
+	HandlerCallSite &site = _callSites[code];
+	site.name = code;
+	return site;
+}
+
+Symbol Lingo::getHandler(const Common::String &name, HandlerCallSite *callSite) {
 	Symbol sym;
+	Movie *movie = g_director->getCurrentMovie();
+
+	uint32 contextSerial = _state->context ? _state->context->_serial : 0;
+
+	// Call sites are dropped along with the handler tables, so a handler
+	// found in them is still there. A handler local to a context is only
+	// used while that same context runs.
+	if (callSite && callSite->resolved && _callSitesGeneration == _handlerCacheGeneration &&
+			callSite->contextSerial == contextSerial && callSite->movie == movie)
+		return callSite->handler ? *callSite->handler : callSite->voidSym;
+
+	const Symbol *handler = nullptr;
 
 	// local functions
-	if (_state->context && _state->context->_functionHandlers.contains(name))
-		return _state->context->_functionHandlers[name];
+	SymbolHash::const_iterator it;
+	if (_state->context && (it = _state->context->_functionHandlers.find(name)) != _state->context->_functionHandlers.end()) {
+		handler = &it->_value;
+	} else {
+		handler = movie->findHandler(name, _state->context ? _state->context->_castLibHint : 0);
+	}
+
+	if (handler) {
+		sym = *handler;
+	} else {
+		sym.type = VOIDSYM;
+		sym.name = new Common::String(name);
+	}
 
-	sym = g_director->getCurrentMovie()->getHandler(name, _state->context ? _state->context->_castLibHint : 0);
-	if (sym.type != VOIDSYM)
-		return sym;
+	if (callSite) {
+		callSite->handler = handler;
+		if (!handler)
+			callSite->voidSym = sym;
+		callSite->contextSerial = contextSerial;
+		callSite->movie = movie;
+		callSite->resolved = true;
+	}
 
-	sym.type = VOIDSYM;
-	sym.name = new Common::String(name);
 	return sym;
 }
 
@@ -371,6 +419,8 @@ void LingoArchive::patchCode(const Common::U32String &code, ScriptType type, uin
 		}
 		sc->_functionHandlers.clear();
 		delete sc;
+
+		Lingo::invalidateHandlerCache();
 	}
 }
 
@@ -393,11 +443,21 @@ void LingoArchive::addCode(const Common::U32String &code, ScriptType type, uint1
 	else
 		contextName = Common::String::format("%d", id);
 
+	uint32 startTime = g_system->getMillis();
+	uint32 parseCacheHits = g_lingo->_compiler->_parseCacheHits;
+
 	ScriptContext *sc = g_lingo->_compiler->compileLingo(code, this, type, CastMemberID(id, cast->_castLibID), contextName, false, preprocFlags);
 	if (sc) {
 		scriptContexts[type][id] = sc;
 		sc->incRefCount();
 	}
+
+	Movie *movie = cast->getMovie();
+	if (movie) {
+		movie->_lingoCompileTime += g_system->getMillis() - startTime;
+		movie->_lingoScriptsCompiled++;
+		movie->_lingoScriptsParseCached += g_lingo->_compiler->_parseCacheHits - parseCacheHits;
+	}
 }
 
 void LingoArchive::removeCode(ScriptType type, uint16 id) {
@@ -618,6 +678,7 @@ Common::String Lingo::formatFunctionBody(Symbol &sym) {
 
 bool Lingo::execute(int targetFrame) {
 	uint localCounter = 0;
+	uint32 startTime = _execNesting++ ? 0 : g_system->getMillis();
 
 	while (!_abort && !_freezeState && !_playDone && _state->script && (*_state->script)[_state->pc] != STOP) {
 		if (targetFrame != -1 && (int)_state->callstack.size() == targetFrame)
@@ -710,6 +771,10 @@ bool Lingo::execute(int targetFrame) {
 	_freezeState = false;
 	_freezePlay = false;
 
+	// Only the outermost call is timed, nested calls are included in it
+	if (--_execNesting == 0 && _vm->getCurrentMovie())
+		_vm->getCurrentMovie()->_lingoExecTime += g_system->getMillis() - startTime;
+
 	g_debugger->stepHook();
 	// return true if execution finished, false if the context froze for later
 	return result;
@@ -231,6 +231,16 @@ struct Builtin {
 	Builtin(void (*func1)(void), int nargs1) : func(func1), nargs(nargs1) {}
 };
 
+// A c_callcmd/c_callfunc instruction, with the handler it resolved to
+struct HandlerCallSite {
+	Common::String name;
+	const Symbol *handler = nullptr;	// not owned, points into the handler table it was found in
+	Symbol voidSym;		// returned when no handler was found
+	uint32 contextSerial = 0;
+	Movie *movie = nullptr;
+	bool resolved = false;
+};
+
 typedef Common::HashMap<int32, ScriptContext *> ScriptContextHash;
 typedef Common::HashMap<int32, Common::HashMap<Common::String, ScriptContext *> *> FactoryContextHash;
 typedef Common::Array<Datum> StackData;
@@ -403,7 +413,21 @@ private:
 
 public:
 	ScriptType event2script(LEvent ev);
-	Symbol getHandler(const Common::String &name);
+	Symbol getHandler(const Common::String &name, HandlerCallSite *callSite = nullptr);
+
+	// Handler lookups are remembered per call site, until any handler
+	// table changes. A call site stays valid until the next getCallSite().
+	HandlerCallSite &getCallSite(const char *code);
+	static void invalidateHandlerCache() { _handlerCacheGeneration++; }
+
+private:
+	// Keyed by the handler name stored inline in the script code, and
+	// dropped together whenever the generation changes
+	Common::HashMap<const void *, HandlerCallSite> _callSites;
+	uint32 _callSitesGeneration;
+	static uint32 _handlerCacheGeneration;
+
+public:
 
 	void processEvents(Common::Queue<LingoEvent> &queue, bool isInputEvent);
 
@@ -552,6 +576,7 @@ public:
 	Common::HashMap<int, const LingoV4TheEntity *> _lingoV4TheEntity;
 
 	uint _globalCounter;
+	uint _execNesting = 0;
 
 	DirectorEngine *_vm;
 
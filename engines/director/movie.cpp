@@ -715,21 +715,33 @@ ScriptContext *Movie::getScriptContext(ScriptType type, CastMemberID id) {
 }
 
 Symbol Movie::getHandler(const Common::String &name, uint16 castLibHint) {
+	const Symbol *handler = findHandler(name, castLibHint);
+
+	return handler ? *handler : Symbol();
+}
+
+const Symbol *Movie::findHandler(const Common::String &name, uint16 castLibHint) {
+	SymbolHash::const_iterator it;
+
 	// Always check the current cast library for a match first
 	if (castLibHint && _casts.contains(castLibHint)) {
-		Cast *cast = _casts.getVal(castLibHint);
-		if (cast->_lingoArchive->functionHandlers.contains(name))
-			return cast->_lingoArchive->functionHandlers[name];
+		const SymbolHash &handlers = _casts.getVal(castLibHint)->_lingoArchive->functionHandlers;
+		if ((it = handlers.find(name)) != handlers.end())
+			return &it->_value;
 	}
-	for (auto &it : _casts) {
-		if (it._value->_lingoArchive->functionHandlers.contains(name))
-			return it._value->_lingoArchive->functionHandlers[name];
+	for (auto &cast : _casts) {
+		const SymbolHash &handlers = cast._value->_lingoArchive->functionHandlers;
+		if ((it = handlers.find(name)) != handlers.end())
+			return &it->_value;
 	}
 
-	if (_sharedCast && _sharedCast->_lingoArchive->functionHandlers.contains(name))
-		return _sharedCast->_lingoArchive->functionHandlers[name];
+	if (_sharedCast) {
+		const SymbolHash &handlers = _sharedCast->_lingoArchive->functionHandlers;
+		if ((it = handlers.find(name)) != handlers.end())
+			return &it->_value;
+	}
 
-	return Symbol();
+	return nullptr;
 }
 
 Common::String InfoEntry::readString(bool pascal) {
@@ -133,6 +133,8 @@ public:
 	LingoArchive *getSharedLingoArch();
 	ScriptContext *getScriptContext(ScriptType type, CastMemberID id);
 	Symbol getHandler(const Common::String &name, uint16 castLibHint = 0);
+	// Not owned, valid until the handler tables change
+	const Symbol *findHandler(const Common::String &name, uint16 castLibHint = 0);
 
 	// events.cpp
 	bool processEvent(Common::Event &event);
@@ -209,6 +211,12 @@ public:
 	// shouldn't be recorded as movie event, which may cause undesirable change in the lingo script
 	bool _inGuiMessageBox = false;
 
+	// Lingo benchmark counters, reported by the debugger 'info' command
+	uint32 _lingoCompileTime = 0;
+	uint32 _lingoExecTime = 0;
+	uint _lingoScriptsCompiled = 0;
+	uint _lingoScriptsParseCached = 0;
+
 private:
 	Window *_window;
 	DirectorEngine *_vm;
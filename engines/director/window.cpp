@@ -345,10 +345,17 @@ void Window::inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::Mana
 		renderStartTime = g_system->getMillis();
 	}
 
+	InkLayer *layer = nullptr;
+
 	if (pd.ms) {
 		pd.inkBlitShape(srcRect);
 	} else if (pd.srf) {
-		pd.inkBlitSurface(srcRect, channel->getMask());
+		const Graphics::Surface *mask = channel->getMask();
+
+		if (channel->getInkLayer(pd, mask, layer))
+			pd.inkBlitLayer(srcRect, layer->surface, layer->coverage);
+		else
+			pd.inkBlitSurface(srcRect, mask);
 	} else {
 		if (debugChannelSet(4, kDebugImages)) {
 			CastType castType = channel->_sprite->_cast ? channel->_sprite->_cast->_type : kCastTypeNull;
@@ -28,7 +28,8 @@ void Glulx::execute_loop() {
 	bool done_executing = false;
 	int ix;
 	uint opcode;
-	const operandlist_t *oplist;
+	decodedinst_t scratch;
+	decodedinst_t *decoded;
 	oparg_t inst[MAX_OPERANDS];
 	uint value, addr, val0, val1;
 	int vals0, vals1;
@@ -48,44 +49,27 @@ void Glulx::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+		/* Instructions in ROM can never change, so they are decoded once and
+		   then picked up from the instruction cache. Anything else is decoded
+		   again each time it runs. Either way this moves the PC up to the
+		   end of the instruction. */
+		if (pc < ramstart) {
+			decoded = &inst_cache[pc & (INST_CACHE_SIZE - 1)];
+			if (decoded->addr == pc) {
+				pc = decoded->nextpc;
 			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+				decode_instruction(decoded);
+				if (pc > ramstart)
+					decoded->addr = DECODEDINST_NONE;
 			}
+		} else {
+			decoded = &scratch;
+			decode_instruction(decoded);
 		}
+		opcode = decoded->opcode;
 
-		/* Now we have an opcode number. */
-
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
-
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
-
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+		/* Load the actual operand values into inst. */
+		load_operands(inst, decoded);
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -145,6 +145,12 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Direct-mapped cache of decoded instructions, indexed by address. Only
+	 * instructions in ROM are cached, since they can never change.
+	 */
+	Common::Array<decodedinst_t> inst_cache;
+
 	/**@}*/
 
 	/**
@@ -543,13 +549,19 @@ public:
 	const operandlist_t *lookup_operandlist(uint opcode);
 
 	/**
-	 * Read the list of operands of an instruction, and put the values in args. This assumes
-	 * that the PC is at the beginning of the operand mode list (right after an opcode number.)
+	 * Read the opcode and the operand addressing modes of the instruction at the PC into inst.
 	 * Upon return, the PC will be at the beginning of the next instruction.
+	 */
+	void decode_instruction(decodedinst_t *inst);
+
+	/**
+	 * Resolve the operands of a decoded instruction, and put the values in args. Loads from
+	 * memory, the locals or the stack are performed here, so this has to be called each time
+	 * the instruction is executed.
 	 *
 	 * This also assumes that args points at an allocated array of MAX_OPERANDS oparg_t structures.
 	*/
-	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
+	void load_operands(oparg_t *opargs, const decodedinst_t *inst);
 
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
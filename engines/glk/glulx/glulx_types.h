@@ -351,6 +351,40 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * How the value of an operand of a decoded instruction is obtained when the
+ * instruction is executed.
+ */
+enum operandkind {
+	operandkind_Const = 0,  ///< Load of a constant value
+	operandkind_Pop,        ///< Load popped off the stack
+	operandkind_Mem,        ///< Load from main memory
+	operandkind_Local,      ///< Load from the locals segment
+	operandkind_Store       ///< Store destination
+};
+
+/**
+ * An instruction whose opcode and operand addressing modes have been decoded,
+ * leaving only the loads to resolve when it is executed.
+ */
+struct decodedinst_struct {
+	uint addr;                      ///< Address of the opcode, or DECODEDINST_NONE
+	uint opcode;
+	uint nextpc;                    ///< Address of the following instruction
+	const operandlist_t *oplist;
+	byte kinds[MAX_OPERANDS];       ///< operandkind of each operand
+	byte desttypes[MAX_OPERANDS];   ///< desttype of each store operand
+	uint values[MAX_OPERANDS];      ///< Constant, address or destaddr of each operand
+};
+typedef decodedinst_struct decodedinst_t;
+
+#define DECODEDINST_NONE (0xFFFFFFFF)
+
+/**
+ * Number of entries in the cache of decoded instructions. Must be a power of two.
+ */
+#define INST_CACHE_SIZE (0x4000)
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
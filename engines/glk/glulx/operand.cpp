@@ -66,6 +66,11 @@ static const operandlist_t list_LLSS = { 4, 4, &array_LLSS[0] };
 void Glulx::init_operands() {
 	for (int ix = 0; ix < 0x80; ix++)
 		fast_operandlist[ix] = lookup_operandlist(ix);
+
+	decodedinst_t empty;
+	empty.addr = DECODEDINST_NONE;
+	inst_cache.clear();
+	inst_cache.resize(INST_CACHE_SIZE, empty);
 }
 
 const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
@@ -279,23 +284,59 @@ const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
 	}
 }
 
-void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
+void Glulx::decode_instruction(decodedinst_t *inst) {
 	int ix;
-	oparg_t *curarg;
+	uint opcode;
+	const operandlist_t *oplist;
+
+	inst->addr = pc;
+
+	/* Fetch the opcode number. */
+	opcode = Mem1(pc);
+	pc++;
+	if (opcode & 0x80) {
+		/* More than one-byte opcode. */
+		if (opcode & 0x40) {
+			/* Four-byte opcode */
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+		} else {
+			/* Two-byte opcode */
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+		}
+	}
+
+	/* Fetch the structure that describes how the operands for this
+	   opcode are arranged. This is a pointer to an immutable,
+	   static object. */
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	inst->opcode = opcode;
+	inst->oplist = oplist;
+
 	int numops = oplist->num_ops;
-	int argsize = oplist->arg_size;
 	uint modeaddr = pc;
 	int modeval = 0;
 
 	pc += (numops + 1) / 2;
 
-	for (ix = 0, curarg = args; ix < numops; ix++, curarg++) {
+	for (ix = 0; ix < numops; ix++) {
 		int mode;
-		uint value;
 		uint addr;
 
-		curarg->desttype = 0;
-
 		if ((ix & 1) == 0) {
 			modeval = Mem1(modeaddr);
 			mode = (modeval & 0x0F);
@@ -309,35 +350,36 @@ void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
 			switch (mode) {
 
 			case 8: /* pop off stack */
-				if (stackptr < valstackbase + 4) {
-					fatal_error("Stack underflow in operand.");
-				}
-				stackptr -= 4;
-				value = Stk4(stackptr);
+				inst->kinds[ix] = operandkind_Pop;
+				inst->values[ix] = 0;
 				break;
 
 			case 0: /* constant zero */
-				value = 0;
+				inst->kinds[ix] = operandkind_Const;
+				inst->values[ix] = 0;
 				break;
 
 			case 1: /* one-byte constant */
 				/* Sign-extend from 8 bits to 32 */
-				value = (int)(signed char)(Mem1(pc));
+				inst->kinds[ix] = operandkind_Const;
+				inst->values[ix] = (int)(signed char)(Mem1(pc));
 				pc++;
 				break;
 
 			case 2: /* two-byte constant */
 				/* Sign-extend the first byte from 8 bits to 32; the subsequent
 				   byte must not be sign-extended. */
-				value = (int)(signed char)(Mem1(pc));
+				inst->kinds[ix] = operandkind_Const;
+				inst->values[ix] = (int)(signed char)(Mem1(pc));
 				pc++;
-				value = (value << 8) | (uint)(Mem1(pc));
+				inst->values[ix] = (inst->values[ix] << 8) | (uint)(Mem1(pc));
 				pc++;
 				break;
 
 			case 3: /* four-byte constant */
 				/* Bytes must not be sign-extended. */
-				value = Mem4(pc);
+				inst->kinds[ix] = operandkind_Const;
+				inst->values[ix] = Mem4(pc);
 				pc += 4;
 				break;
 
@@ -376,13 +418,8 @@ void Glulx::parse_operands(oparg_t *args, const operandlist_t *oplist) {
 
 MainMemAddr:
 				/* cases 5, 6, 7, 13, 14, 15 all wind up here. */
-				if (argsize == 4) {
-					value = Mem4(addr);
-				} else if (argsize == 2) {
-					value = Mem2(addr);
-				} else {
-					value = Mem1(addr);
-				}
+				inst->kinds[ix] = operandkind_Mem;
+				inst->values[ix] = addr;
 				break;
 
 			case 11: /* locals, four-byte address */
@@ -405,35 +442,30 @@ LocalsAddr:
 				   be four-byte aligned, but we don't check this explicitly.
 				   A "strict mode" interpreter probably should. It's also illegal
 				   for addr to be less than zero or greater than the size of
-				   the locals segment. */
-				addr += localsbase;
-				if (argsize == 4) {
-					value = Stk4(addr);
-				} else if (argsize == 2) {
-					value = Stk2(addr);
-				} else {
-					value = Stk1(addr);
-				}
+				   the locals segment. The address is relative to the current
+				   locals segment, which is only known when the instruction
+				   is executed. */
+				inst->kinds[ix] = operandkind_Local;
+				inst->values[ix] = addr;
 				break;
 
 			default:
-				value = 0;
 				fatal_error("Unknown addressing mode in load operand.");
 			}
 
-			curarg->value = value;
-
 		} else { /* modeform_Store */
+			inst->kinds[ix] = operandkind_Store;
+
 			switch (mode) {
 
 			case 0: /* discard value */
-				curarg->desttype = 0;
-				curarg->value = 0;
+				inst->desttypes[ix] = 0;
+				inst->values[ix] = 0;
 				break;
 
 			case 8: /* push on stack */
-				curarg->desttype = 3;
-				curarg->value = 0;
+				inst->desttypes[ix] = 3;
+				inst->values[ix] = 0;
 				break;
 
 			case 15: /* main memory RAM, four-byte address */
@@ -471,8 +503,8 @@ LocalsAddr:
 
 WrMainMemAddr:
 				/* cases 5, 6, 7 all wind up here. */
-				curarg->desttype = 1;
-				curarg->value = addr;
+				inst->desttypes[ix] = 1;
+				inst->values[ix] = addr;
 				break;
 
 			case 11: /* locals, four-byte address */
@@ -496,11 +528,11 @@ WrLocalsAddr:
 				   A "strict mode" interpreter probably should. It's also illegal
 				   for addr to be less than zero or greater than the size of
 				   the locals segment. */
-				curarg->desttype = 2;
+				inst->desttypes[ix] = 2;
 				/* We don't add localsbase here; the store address for desttype 2
 				   is relative to the current locals segment, not an absolute
 				   stack position. */
-				curarg->value = addr;
+				inst->values[ix] = addr;
 				break;
 
 			case 1:
@@ -514,6 +546,65 @@ WrLocalsAddr:
 			}
 		}
 	}
+
+	inst->nextpc = pc;
+}
+
+void Glulx::load_operands(oparg_t *args, const decodedinst_t *inst) {
+	int ix;
+	oparg_t *curarg;
+	int numops = inst->oplist->num_ops;
+	int argsize = inst->oplist->arg_size;
+
+	for (ix = 0, curarg = args; ix < numops; ix++, curarg++) {
+		uint addr;
+
+		switch (inst->kinds[ix]) {
+
+		case operandkind_Const:
+			curarg->desttype = 0;
+			curarg->value = inst->values[ix];
+			break;
+
+		case operandkind_Pop:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			curarg->desttype = 0;
+			curarg->value = Stk4(stackptr);
+			break;
+
+		case operandkind_Mem:
+			addr = inst->values[ix];
+			curarg->desttype = 0;
+			if (argsize == 4) {
+				curarg->value = Mem4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Mem2(addr);
+			} else {
+				curarg->value = Mem1(addr);
+			}
+			break;
+
+		case operandkind_Local:
+			addr = inst->values[ix] + localsbase;
+			curarg->desttype = 0;
+			if (argsize == 4) {
+				curarg->value = Stk4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Stk2(addr);
+			} else {
+				curarg->value = Stk1(addr);
+			}
+			break;
+
+		default: /* operandkind_Store */
+			curarg->desttype = inst->desttypes[ix];
+			curarg->value = inst->values[ix];
+			break;
+		}
+	}
 }
 
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
@@ -186,4 +186,16 @@ size_t Screen::stringWidthUni(int fontIdx, const Common::U32String &text, int sp
 	return font->getStringWidth(text) * GLI_SUBPIX;
 }
 
+size_t Screen::charsWidthUni(int fontIdx, const uint32 *text, size_t len, uint32 prev) {
+	const Graphics::Font *font = _fonts[fontIdx];
+	int width = 0;
+
+	for (size_t i = 0; i < len; ++i) {
+		width += font->getCharWidth(text[i]) + font->getKerningOffset(prev, text[i]);
+		prev = text[i];
+	}
+
+	return width * GLI_SUBPIX;
+}
+
 } // End of namespace Glk
@@ -132,6 +132,17 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels of a run of unicode characters, without having
+	 * to copy them into a string first
+	 * @param fontIdx   Which font to use
+	 * @param text      Characters to get the width of
+	 * @param len       Number of characters
+	 * @param prev      Character preceding the run for kerning, or 0 if there is none
+	 * @returns         Width of the characters multiplied by GLI_SUBPIX
+	 */
+	size_t charsWidthUni(int fontIdx, const uint32 *text, size_t len, uint32 prev = 0);
 };
 
 } // End of namespace Glk
@@ -39,8 +39,9 @@ TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(win
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
-		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
-		_copyBuf(nullptr), _copyPos(0) {
+		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _lineWidthsValid(0),
+		_spaced(0), _dashed(0), _copyBuf(nullptr), _copyPos(0) {
+	_lineWidths[0] = 0;
 	_type = wintype_TextBuffer;
 	_history.resize(HISTORYLEN);
 
@@ -309,6 +310,8 @@ void TextBufferWindow::putText(const char *buf, int len, int pos, int oldlen) {
 	if (_numChars + diff >= TBLINELEN)
 		return;
 
+	_lineWidthsValid = MIN(_lineWidthsValid, pos);
+
 	if (diff != 0 && pos + oldlen < _numChars) {
 		memmove(_chars + pos + len,
 				_chars + pos + oldlen,
@@ -341,6 +344,8 @@ void TextBufferWindow::putTextUni(const uint32 *buf, int len, int pos, int oldle
 	if (_numChars + diff >= TBLINELEN)
 		return;
 
+	_lineWidthsValid = MIN(_lineWidthsValid, pos);
+
 	if (diff != 0 && pos + oldlen < _numChars) {
 		memmove(_chars + pos + len,
 				_chars + pos + oldlen,
@@ -478,6 +483,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 		}
 	}
 
+	_lineWidthsValid = MIN(_lineWidthsValid, _numChars);
 	_chars[_numChars] = ch;
 	_attrs[_numChars] = _attr;
 	_numChars++;
@@ -489,7 +495,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			&& !_styles[_attrs[linelen - 1].style].reverse)
 		linelen--;
 
-	if (calcWidth(_chars, _attrs, 0, linelen, -1) >= pw) {
+	if (lineWidth(linelen) >= pw) {
 		bpoint = _numChars;
 
 		for (i = _numChars - 1; i > 0; i--) {
@@ -541,6 +547,7 @@ void TextBufferWindow::clear() {
 	_dashed = 0;
 
 	_numChars = 0;
+	_lineWidthsValid = 0;
 
 	for (i = 0; i < _scrollBack; i++) {
 		_lines[i]._len = 0;
@@ -1580,6 +1587,7 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 		a->clear();
 
 	_numChars = 0;
+	_lineWidthsValid = 0;
 
 	touchScroll();
 
@@ -1619,17 +1627,30 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	a = startchar;
 	for (b = startchar; b < numChars; b++) {
 		if (attrs[a] != attrs[b]) {
-			w += screen.stringWidthUni(attrs[a].attrFont(_styles),
-									   Common::U32String(chars + a, b - a), spw);
+			w += screen.charsWidthUni(attrs[a].attrFont(_styles), chars + a, b - a);
 			a = b;
 		}
 	}
 
-	w += screen.stringWidthUni(attrs[a].attrFont(_styles), Common::U32String(chars + a, b - a), spw);
+	w += screen.charsWidthUni(attrs[a].attrFont(_styles), chars + a, b - a);
 
 	return w;
 }
 
+int TextBufferWindow::lineWidth(int numChars) {
+	Screen &screen = *g_vm->_screen;
+
+	// Characters are measured as calcWidth does: one run per attribute
+	// change, with kerning only applied between characters of the same run
+	for (; _lineWidthsValid < numChars; _lineWidthsValid++) {
+		int i = _lineWidthsValid;
+		uint32 prev = (i > 0 && _attrs[i] == _attrs[i - 1]) ? _chars[i - 1] : 0;
+		_lineWidths[i + 1] = _lineWidths[i] + screen.charsWidthUni(_attrs[i].attrFont(_styles), _chars + i, 1, prev);
+	}
+
+	return _lineWidths[numChars];
+}
+
 void TextBufferWindow::getSize(uint *width, uint *height) const {
 	if (width)
 		*width = (_bbox.width() - g_conf->_tMarginX * 2) / _font._cellW;
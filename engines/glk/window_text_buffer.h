@@ -91,6 +91,12 @@ private:
 	void scrollOneLine(bool forced);
 	void scrollResize();
 	int calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numchars, int spw);
+
+	/**
+	 * Returns the width of the first characters of the line being written,
+	 * as calcWidth would, reusing the widths measured on previous calls
+	 */
+	int lineWidth(int numChars);
 public:
 	int _width, _height;
 	int _spaced;
@@ -103,6 +109,9 @@ public:
 	uint32 *_chars;       ///< alias to lines[0].chars
 	Attributes *_attrs;   ///< alias to lines[0].attrs
 
+	int _lineWidths[TBLINELEN + 1]; ///< widths of the leading chars of lines[0]
+	int _lineWidthsValid; ///< number of chars in lines[0] with a known width
+
 	///< adjust margins temporarily for images
 	int _ladjw;
 	int _ladjn;
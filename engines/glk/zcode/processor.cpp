@@ -204,18 +204,7 @@ void Processor::load_operand(zbyte type) {
 
 	if (type & 2) {
 		// variable
-		zbyte variable;
-
-		CODE_BYTE(variable);
-
-		if (variable == 0)
-			value = *_sp++;
-		else if (variable < 16)
-			value = *(_fp - variable);
-		else {
-			zword addr = h_globals + 2 * (variable - 16);
-			LOW_WORD(addr, value);
-		}
+		value = load_variable(codeByte());
 	} else if (type & 1) {
 		// small constant
 		zbyte bvalue;
@@ -249,17 +238,51 @@ void Processor::interpret() {
 		zargc = 0;
 
 		if (opcode < 0x80) {
-			// 2OP opcodes
-			load_operand((zbyte)(opcode & 0x40) ? 2 : 1);
-			load_operand((zbyte)(opcode & 0x20) ? 2 : 1);
-
-			(*this.*var_opcodes[opcode & 0x1f])();
+			// 2OP opcodes. Their long form has exactly two operands, each either
+			// a variable or a small constant, so they are loaded in place and the
+			// most frequently executed opcodes are run without a table call
+			zargs[0] = (opcode & 0x40) ? load_variable(codeByte()) : codeByte();
+			zargs[1] = (opcode & 0x20) ? load_variable(codeByte()) : codeByte();
+			zargc = 2;
+
+			switch (opcode & 0x1f) {
+			case 0x01:	// je
+				branch(zargs[0] == zargs[1]);
+				break;
+			case 0x02:	// jl
+				branch((short)zargs[0] < (short)zargs[1]);
+				break;
+			case 0x03:	// jg
+				branch((short)zargs[0] > (short)zargs[1]);
+				break;
+			case 0x07:	// test
+				branch((zargs[0] & zargs[1]) == zargs[1]);
+				break;
+			case 0x0f:	// loadw
+				store(READ_BE_UINT16(&zmp[(zword)(zargs[0] + 2 * zargs[1])]));
+				break;
+			case 0x10:	// loadb
+				store(zmp[(zword)(zargs[0] + zargs[1])]);
+				break;
+			case 0x14:	// add
+				store((zword)((short)zargs[0] + (short)zargs[1]));
+				break;
+			case 0x15:	// sub
+				store((zword)((short)zargs[0] - (short)zargs[1]));
+				break;
+			default:
+				(*this.*var_opcodes[opcode & 0x1f])();
+				break;
+			}
 
 		} else if (opcode < 0xb0) {
 			// 1OP opcodes
 			load_operand((zbyte)(opcode >> 4));
 
-			(*this.*op1_opcodes[opcode & 0x0f])();
+			if ((opcode & 0x0f) == 0)	// jz
+				branch(zargs[0] == 0);
+			else
+				(*this.*op1_opcodes[opcode & 0x0f])();
 
 		} else if (opcode < 0xc0) {
 			// 0OP opcodes
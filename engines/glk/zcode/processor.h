@@ -100,6 +100,20 @@ protected:
 	 * @{
 	 */
 
+	/**
+	 * Read the value of a variable: the top of the stack, a local or a global.
+	 * Reading the top of the stack pops it.
+	 */
+	zword load_variable(zbyte variable) {
+		if (variable == 0)
+			return *_sp++;
+		if (variable < 16)
+			return *(_fp - variable);
+
+		zword addr = h_globals + 2 * (variable - 16);
+		return READ_BE_UINT16(&zmp[addr]);
+	}
+
 	/**
 	 * Load an operand, either a variable or a constant.
 	 */
@@ -30,6 +30,22 @@
 
 namespace Grim {
 
+// Returns the first keyframe at or after the given time, or -1 if the
+// animation has no keyframe that late. Keyframes are sorted by time.
+template<typename T>
+static int findKeyframe(const T *keyframes, int count, float time) {
+	int low = 0;
+	int high = count;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (keyframes[mid]._time >= time)
+			high = mid;
+		else
+			low = mid + 1;
+	}
+	return low < count ? low : -1;
+}
+
 AnimationEmi::AnimationEmi(const Common::String &filename, Common::SeekableReadStream *data) :
 		_name(""), _duration(0.0f), _numBones(0), _bones(nullptr) {
 	_fname = filename;
@@ -211,7 +227,7 @@ void AnimationStateEmi::animate() {
 		JointAnimation &jointAnim = layer->_jointAnims[jointIndex];
 
 		if (curBone._rotations) {
-			int keyfIdx = -1;
+			int keyfIdx;
 			Math::Quaternion quat;
 
 			// Normalize the weight so that the sum of applied weights will equal 1.
@@ -221,12 +237,7 @@ void AnimationStateEmi::animate() {
 				normalizedRotWeight = _fade / jointAnim._rotWeight;
 			}
 
-			for (int curKeyFrame = 0; curKeyFrame < curBone._count; curKeyFrame++) {
-				if (curBone._rotations[curKeyFrame]._time >= _time) {
-					keyfIdx = curKeyFrame;
-					break;
-				}
-			}
+			keyfIdx = findKeyframe(curBone._rotations, curBone._count, _time);
 
 			if (keyfIdx == 0) {
 				quat = curBone._rotations[0]._quat;
@@ -248,7 +259,7 @@ void AnimationStateEmi::animate() {
 		}
 
 		if (curBone._translations) {
-			int keyfIdx = -1;
+			int keyfIdx;
 			Math::Vector3d vec;
 
 			// Normalize the weight so that the sum of applied weights will equal 1.
@@ -258,12 +269,7 @@ void AnimationStateEmi::animate() {
 				normalizedTransWeight = _fade / jointAnim._transWeight;
 			}
 
-			for (int curKeyFrame = 0; curKeyFrame < curBone._count; curKeyFrame++) {
-				if (curBone._translations[curKeyFrame]._time >= _time) {
-					keyfIdx = curKeyFrame;
-					break;
-				}
-			}
+			keyfIdx = findKeyframe(curBone._translations, curBone._count, _time);
 
 			if (keyfIdx == 0) {
 				vec = curBone._translations[0]._vec;
@@ -35,7 +35,7 @@ namespace Grim {
 #define TRANSLATE_OP 3
 
 Skeleton::Skeleton(const Common::String &filename, Common::SeekableReadStream *data) :
-		_numJoints(0), _joints(nullptr), _animLayers(nullptr) {
+		_numJoints(0), _joints(nullptr), _animLayers(nullptr), _animStatesDirty(true) {
 	loadSkeleton(data);
 }
 
@@ -113,7 +113,35 @@ void Skeleton::resetAnim() {
 	}
 }
 
+bool Skeleton::updateAnimStates() {
+	bool changed = _animStatesDirty || _animStates.size() != _activeAnims.size();
+	_animStates.resize(_activeAnims.size());
+	_animStatesDirty = false;
+
+	uint i = 0;
+	for (Common::List<AnimationStateEmi*>::iterator j = _activeAnims.begin(); j != _activeAnims.end(); ++j, ++i) {
+		AnimStateKey &key = _animStates[i];
+		if (key._anim != *j || key._time != (*j)->_time || key._fade != (*j)->_fade) {
+			key._anim = *j;
+			key._time = (*j)->_time;
+			key._fade = (*j)->_fade;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
 void Skeleton::animate() {
+	// Paused animations and held poses produce the same blend every frame.
+	if (!updateAnimStates()) {
+		for (int i = 0; i < _numJoints; ++i) {
+			_joints[i]._animMatrix = _joints[i]._blendMatrix;
+			_joints[i]._animQuat = _joints[i]._blendQuat;
+		}
+		commitAnim();
+		return;
+	}
+
 	resetAnim();
 
 	// This first pass over the animations calculates bone-specific sums of blend weights for all
@@ -132,26 +160,27 @@ void Skeleton::animate() {
 	// layer will get as much weight as it wants, while the next highest priority will get the
 	// amount that remains and so on.
 	for (int i = 0; i < _numJoints; ++i) {
+		Joint &joint = _joints[i];
 		float remainingTransWeight = 1.0f;
 		float remainingRotWeight = 1.0f;
+		bool rotated = false;
+		bool translated = false;
+		Math::Vector3d pos = joint._animMatrix.getPosition();
 
 		for (int j = MAX_ANIMATION_LAYERS - 1; j >= 0; --j) {
 			AnimationLayer &layer = _animLayers[j];
 			JointAnimation &jointAnim = layer._jointAnims[i];
 
 			if (remainingRotWeight > 0.0f && jointAnim._rotWeight != 0.0f) {
-				Math::Vector3d pos = _joints[i]._animMatrix.getPosition();
-				_joints[i]._animQuat = _joints[i]._animQuat.slerpQuat(_joints[i]._animQuat * jointAnim._quat, remainingRotWeight);
-				_joints[i]._animQuat.toMatrix(_joints[i]._animMatrix);
-				_joints[i]._animMatrix.setPosition(pos);
+				joint._animQuat = joint._animQuat.slerpQuat(joint._animQuat * jointAnim._quat, remainingRotWeight);
+				rotated = true;
 
 				remainingRotWeight *= 1.0f - jointAnim._rotWeight;
 			}
 
 			if (remainingTransWeight > 0.0f && jointAnim._transWeight != 0.0f) {
-				Math::Vector3d pos = _joints[i]._animMatrix.getPosition();
-				Math::Vector3d delta = jointAnim._pos;
-				_joints[i]._animMatrix.setPosition(pos + delta * remainingTransWeight);
+				pos += jointAnim._pos * remainingTransWeight;
+				translated = true;
 
 				remainingTransWeight *= 1.0f - jointAnim._transWeight;
 			}
@@ -159,6 +188,15 @@ void Skeleton::animate() {
 			if (remainingRotWeight <= 0.0f && remainingTransWeight <= 0.0f)
 				break;
 		}
+
+		// Build the matrix once, instead of for every layer that touches the joint.
+		if (rotated)
+			joint._animQuat.toMatrix(joint._animMatrix);
+		if (rotated || translated)
+			joint._animMatrix.setPosition(pos);
+
+		joint._blendMatrix = joint._animMatrix;
+		joint._blendQuat = joint._animQuat;
 	}
 
 	commitAnim();
@@ -166,9 +204,11 @@ void Skeleton::animate() {
 
 void Skeleton::addAnimation(AnimationStateEmi *anim) {
 	_activeAnims.push_back(anim);
+	_animStatesDirty = true;
 }
 void Skeleton::removeAnimation(AnimationStateEmi *anim) {
 	_activeAnims.remove(anim);
+	_animStatesDirty = true;
 }
 
 void Skeleton::commitAnim() {
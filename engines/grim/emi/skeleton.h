@@ -52,6 +52,10 @@ struct Joint {
 	Math::Quaternion _animQuat;
 	Math::Matrix4 _finalMatrix;
 	Math::Quaternion _finalQuat;
+	// Result of the last layer blend, before costume components such as
+	// EMIHead apply their changes on top of _animMatrix.
+	Math::Matrix4 _blendMatrix;
+	Math::Quaternion _blendQuat;
 };
 
 struct JointAnimation {
@@ -71,6 +75,7 @@ class Skeleton : public Object {
 	void initBone(int index);
 	void initBones();
 	void resetAnim();
+	bool updateAnimStates();
 public:
 	// Note: EMI uses priority 5 at most.
 	static const int MAX_ANIMATION_LAYERS = 8;
@@ -96,6 +101,16 @@ public:
 private:
 	AnimationLayer *_animLayers;
 	Common::List<AnimationStateEmi*> _activeAnims;
+
+	// Time and fade of the active animations when the joints were last blended.
+	// If none of them changed the blend result is reused.
+	struct AnimStateKey {
+		AnimationStateEmi *_anim;
+		int _time;
+		float _fade;
+	};
+	Common::Array<AnimStateKey> _animStates;
+	bool _animStatesDirty;
 };
 
 } // end of namespace Grim
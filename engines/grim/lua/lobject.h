@@ -83,6 +83,7 @@ typedef struct TaggedString {
 	GCnode head;
 	int32 constindex;  // hint to reuse constants (= -1 if this is a userdata)
 	uint32 hash;
+	int32 slothint;  // table slot this string was last found at as a key
 	TObject globalval;
 	char str[1];   // \0 byte already reserved
 } TaggedString;
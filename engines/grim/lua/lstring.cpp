@@ -19,7 +19,7 @@ namespace Grim {
 
 #define gcsizestring(l)      (1 + (l / 64))  // "weight" for a string with length 'l'
 
-TaggedString EMPTY = {{nullptr, 2}, 0, 0L, {LUA_T_NIL, {nullptr}}, {0}};
+TaggedString EMPTY = {{nullptr, 2}, 0, 0L, 0, {LUA_T_NIL, {nullptr}}, {0}};
 
 void luaS_init() {
 	int32 i;
@@ -85,6 +85,7 @@ static TaggedString *newone(const char *buff, int32 tag, uint32 h) {
 	ts->head.marked = 0;
 	ts->head.next = (GCnode *)ts;  // signal it is in no list
 	ts->hash = h;
+	ts->slothint = 0;
 	return ts;
 }
 
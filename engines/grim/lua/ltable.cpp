@@ -151,6 +151,8 @@ static void rehash(Hash *t) {
 ** null.
 */
 TObject *luaH_get(Hash *t, TObject *r) {
+	if (ttype(r) == LUA_T_STRING)
+		return luaH_getstr(t, tsvalue(r));
 	int32 h = present(t, r);
 	if (ttype(ref(node(t, h))) != LUA_T_NIL)
 		return val(node(t, h));
@@ -158,6 +160,40 @@ TObject *luaH_get(Hash *t, TObject *r) {
 		return nullptr;
 }
 
+/*
+** Same as luaH_get for string keys. Field names are usually looked up in
+** several tables built the same way (actors, sets), so the slot the string
+** was last found at is tried before probing.
+*/
+TObject *luaH_getstr(Hash *t, TaggedString *ts) {
+	int32 tsize = nhash(t);
+	int32 h1 = ts->slothint;
+	TObject *rf;
+	if (h1 < tsize) {
+		rf = ref(node(t, h1));
+		if (ttype(rf) == LUA_T_STRING && tsvalue(rf) == ts)
+			return val(node(t, h1));
+	}
+	intptr h = (intptr)ts;
+	if (h < 0)
+		h = -(h + 1);
+	h1 = int32(h % tsize);
+	rf = ref(node(t, h1));
+	if (ttype(rf) != LUA_T_NIL && (ttype(rf) != LUA_T_STRING || tsvalue(rf) != ts)) {
+		int32 h2 = int32(h % (tsize - 2) + 1);
+		do {
+			h1 += h2;
+			if (h1 >= tsize)
+				h1 -= tsize;
+			rf = ref(node(t, h1));
+		} while (ttype(rf) != LUA_T_NIL && (ttype(rf) != LUA_T_STRING || tsvalue(rf) != ts));
+	}
+	if (ttype(rf) == LUA_T_NIL)
+		return nullptr;
+	ts->slothint = h1;
+	return val(node(t, h1));
+}
+
 /*
 ** If the hash node is present, return its pointer, otherwise create a luaM_new
 ** node for the given reference and also return its pointer.
@@ -115,6 +115,27 @@ void luaV_gettable() {
 		lua_error("indexed expression not a table");
 }
 
+/*
+** Fast path of luaV_gettable for the constant string index of GETDOTTED
+** and PUSHSELF: indexes the table at t in place without going through
+** the stack. Returns false if a tag method has to be called instead.
+*/
+static bool luaV_getdotted(TObject *t, TObject *key) {
+	if (ttype(t) != LUA_T_ARRAY || ttype(key) != LUA_T_STRING)
+		return false;
+	int32 tg = avalue(t)->htag;
+	if (ttype(luaT_getim(tg, IM_GETTABLE)) != LUA_T_NIL)
+		return false;
+	TObject *h = luaH_getstr(avalue(t), tsvalue(key));
+	if (h && ttype(h) != LUA_T_NIL)
+		*t = *h;
+	else if (ttype(luaT_getim(tg, IM_INDEX)) != LUA_T_NIL)
+		return false;
+	else
+		ttype(t) = LUA_T_NIL;
+	return true;
+}
+
 /*
 ** Function to store indexed based on values at the stack.top
 ** mode = 0: raw store (without tag methods)
@@ -335,8 +356,10 @@ getglobal:
 		case GETDOTTED7:
 			task->aux -= GETDOTTED0;
 getdotted:
-			*task->S->top++ = task->consts[task->aux];
-			luaV_gettable();
+			if (!luaV_getdotted(task->S->top - 1, &task->consts[task->aux])) {
+				*task->S->top++ = task->consts[task->aux];
+				luaV_gettable();
+			}
 			break;
 		case PUSHSELFW:
 			task->aux = next_word(task->pc);
@@ -356,8 +379,10 @@ getdotted:
 pushself:
 			{
 				TObject receiver = *(task->S->top - 1);
-				*task->S->top++ = task->consts[task->aux];
-				luaV_gettable();
+				if (!luaV_getdotted(task->S->top - 1, &task->consts[task->aux])) {
+					*task->S->top++ = task->consts[task->aux];
+					luaV_gettable();
+				}
 				*task->S->top++ = receiver;
 				break;
 			}
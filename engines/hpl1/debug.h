@@ -40,6 +40,7 @@ enum DebugChannels {
 	kDebugTextures,
 	kDebugScripts,
 	kDebugShaders,
+	kDebugPhysics,
 };
 
 enum DebugLevels {
@@ -37,6 +37,7 @@
 #include "hpl1/engine/impl/tinyXML/tinyxml.h"
 
 #include "common/algorithm.h"
+#include "common/hash-ptr.h"
 
 namespace hpl {
 
@@ -47,6 +48,7 @@ namespace hpl {
 //-----------------------------------------------------------------------
 
 cAINode::cAINode() {
+	mlIsland = -1;
 }
 
 //-----------------------------------------------------------------------
@@ -239,6 +241,8 @@ cAINodeContainer::cAINodeContainer(const tString &asName, const tString &asNodeN
 
 	mlNodesPerGrid = 6;
 
+	mlIslandNum = 0;
+
 	mbNodeIsAtCenter = true;
 }
 
@@ -377,6 +381,8 @@ void cAINodeContainer::Compile() {
 
 		// Log("  Final edge count: %d\n",pNode->mvEdges.size());
 	}
+
+	BuildIslands();
 }
 
 //-----------------------------------------------------------------------
@@ -580,6 +586,8 @@ void cAINodeContainer::LoadFromFile(const tString &asFile) {
 	}
 
 	hplDelete(pXmlDoc);
+
+	BuildIslands();
 }
 //-----------------------------------------------------------------------
 
@@ -589,6 +597,54 @@ void cAINodeContainer::LoadFromFile(const tString &asFile) {
 
 //-----------------------------------------------------------------------
 
+static int FindIslandRoot(Common::Array<int> &avParents, int alIdx) {
+	while (avParents[alIdx] != alIdx) {
+		// Path halving keeps the trees flat.
+		avParents[alIdx] = avParents[avParents[alIdx]];
+		alIdx = avParents[alIdx];
+	}
+	return alIdx;
+}
+
+void cAINodeContainer::BuildIslands() {
+	////////////////////////////////////
+	// Union the nodes connected by edges. Edges are treated as two-way, so an
+	// island is a superset of what is reachable and can be used for early outs.
+	Common::HashMap<cAINode *, int> mapIndices;
+	Common::Array<int> vParents(mvNodes.size());
+	for (size_t i = 0; i < mvNodes.size(); ++i) {
+		mapIndices[mvNodes[i]] = (int)i;
+		vParents[i] = (int)i;
+	}
+
+	for (size_t i = 0; i < mvNodes.size(); ++i) {
+		cAINode *pNode = mvNodes[i];
+		for (size_t j = 0; j < pNode->mvEdges.size(); ++j) {
+			Common::HashMap<cAINode *, int>::const_iterator it = mapIndices.find(pNode->mvEdges[j].mpNode);
+			if (it == mapIndices.end())
+				continue;
+
+			int lRootA = FindIslandRoot(vParents, (int)i);
+			int lRootB = FindIslandRoot(vParents, it->_value);
+			if (lRootA != lRootB)
+				vParents[lRootB] = lRootA;
+		}
+	}
+
+	////////////////////////////////////
+	// Give the islands compact ids
+	Common::Array<int> vIslandIds(mvNodes.size(), -1);
+	mlIslandNum = 0;
+	for (size_t i = 0; i < mvNodes.size(); ++i) {
+		int lRoot = FindIslandRoot(vParents, (int)i);
+		if (vIslandIds[lRoot] < 0)
+			vIslandIds[lRoot] = mlIslandNum++;
+		mvNodes[i]->mlIsland = vIslandIds[lRoot];
+	}
+}
+
+//-----------------------------------------------------------------------
+
 cVector2l cAINodeContainer::GetGridPosFromLocal(const cVector2f &avLocalPos) {
 	cVector2l vGridPos;
 	vGridPos.x = (int)(avLocalPos.x / mvGridSize.x);
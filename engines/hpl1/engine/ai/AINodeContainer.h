@@ -78,11 +78,18 @@ public:
 
 	const tString &GetName() { return msName; }
 
+	/**
+	 * Set of nodes that are connected to each other, -1 until the container is compiled.
+	 */
+	int GetIsland() const { return mlIsland; }
+
 private:
 	tString msName;
 	cVector3f mvPosition;
 	void *mpUserData;
 
+	int mlIsland;
+
 	tAINodeEdgeVec mvEdges;
 };
 
@@ -267,7 +274,11 @@ public:
 	 */
 	void LoadFromFile(const tString &asFile);
 
+	int GetIslandNum() const { return mlIslandNum; }
+
 private:
+	void BuildIslands();
+
 	cVector2l GetGridPosFromLocal(const cVector2f &avLocalPos);
 	cAIGridNode *GetGrid(const cVector2l &avPos);
 
@@ -291,6 +302,8 @@ private:
 
 	Common::Array<cAIGridNode> mvGrids;
 
+	int mlIslandNum;
+
 	// properties
 	int mlMaxNodeEnds;
 	int mlMinNodeEnds;
@@ -147,6 +147,11 @@ bool cAStarHandler::GetPath(const cVector3f &avStart, const cVector3f &avGoal, t
 	}
 	// Log(" Found goal\n");
 
+	////////////////////////////////////////////////
+	// If no goal node is connected to a start node, no need to search the graph.
+	if (GoalIsOnStartIsland() == false)
+		return false;
+
 	/*for(int i=0; i<mpContainer->GetNodeNum(); ++i)
 	{
 		cAINode *pAINode = mpContainer->GetNode(i);
@@ -311,6 +316,36 @@ float cAStarHandler::Heuristic(const cVector3f &avStart, const cVector3f &avGoal
 
 //-----------------------------------------------------------------------
 
+bool cAStarHandler::GoalIsOnStartIsland() {
+	if (m_setOpenList.empty() || m_setGoalNodes.empty())
+		return false;
+
+	// Container has not been compiled, islands are unknown.
+	if (mpContainer->GetIslandNum() == 0)
+		return true;
+
+	// Nodes added after compiling have no island yet, so they could connect anything.
+	for (tAINodeSetIt goalIt = m_setGoalNodes.begin(); goalIt != m_setGoalNodes.end(); ++goalIt) {
+		if ((*goalIt)->GetIsland() < 0)
+			return true;
+	}
+
+	for (tAStarNodeSetIt startIt = m_setOpenList.begin(); startIt != m_setOpenList.end(); ++startIt) {
+		int lIsland = (*startIt)->mpAINode->GetIsland();
+		if (lIsland < 0)
+			return true;
+
+		for (tAINodeSetIt goalIt = m_setGoalNodes.begin(); goalIt != m_setGoalNodes.end(); ++goalIt) {
+			if ((*goalIt)->GetIsland() == lIsland)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+//-----------------------------------------------------------------------
+
 bool cAStarHandler::IsGoalNode(cAINode *apAINode) {
 	tAINodeSetIt it = m_setGoalNodes.find(apAINode);
 	if (it == m_setGoalNodes.end())
@@ -97,6 +97,8 @@ public:
 	void SetCallback(iAStarCallback *apCallback) { mpCallback = apCallback; }
 
 private:
+	bool GoalIsOnStartIsland();
+
 	void IterateAlgorithm();
 
 	void AddOpenNode(cAINode *apAINode, cAStarNode *apParent, float afDistance);
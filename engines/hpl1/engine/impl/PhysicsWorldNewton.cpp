@@ -52,6 +52,9 @@
 
 namespace hpl {
 
+// Same as MIN_TIMESTEP in NewtonClass.h
+static const float kNewtonMinTimeStep = 1.0f / 1000.0f;
+
 //////////////////////////////////////////////////////////////////////////
 // CONSTRUCTORS
 //////////////////////////////////////////////////////////////////////////
@@ -73,6 +76,8 @@ cPhysicsWorldNewton::cPhysicsWorldNewton()
 
 	mvGravity = cVector3f(0, -9.81f, 0);
 	mfMaxTimeStep = 1.0f / 60.0f;
+	mfTimeStepRemainder = 0;
+	mlLastSubStepCount = 0;
 
 	/////////////////////////////////
 	// Create default material.
@@ -112,11 +117,23 @@ void cPhysicsWorldNewton::Simulate(float afTimeStep) {
 
 	// if(lUpdate % 30==0)
 	{
+		mlLastSubStepCount = 0;
+		afTimeStep += mfTimeStepRemainder;
+		mfTimeStepRemainder = 0;
+
 		while (afTimeStep > mfMaxTimeStep) {
 			NewtonUpdate(mpNewtonWorld, mfMaxTimeStep);
 			afTimeStep -= mfMaxTimeStep;
+			++mlLastSubStepCount;
+		}
+		// Newton clamps steps to at least MIN_TIMESTEP (1/1000 s), so a tiny remainder would run
+		// a full solver step and simulate time that has not passed. Keep it for later.
+		if (afTimeStep >= kNewtonMinTimeStep) {
+			NewtonUpdate(mpNewtonWorld, afTimeStep);
+			++mlLastSubStepCount;
+		} else {
+			mfTimeStepRemainder = afTimeStep;
 		}
-		NewtonUpdate(mpNewtonWorld, afTimeStep);
 	}
 	// lUpdate++;
 	// cPhysicsBodyNewton::SetUseCallback(true);
@@ -39,6 +39,7 @@ public:
 	~cPhysicsWorldNewton();
 
 	void Simulate(float afTimeStep);
+	int GetLastSubStepCount() { return mlLastSubStepCount; }
 
 	void SetMaxTimeStep(float afTimeStep);
 	float GetMaxTimeStep();
@@ -105,6 +106,8 @@ private:
 	cVector3f mvWorldSizeMax;
 	cVector3f mvGravity;
 	float mfMaxTimeStep;
+	float mfTimeStepRemainder;
+	int mlLastSubStepCount;
 
 	ePhysicsAccuracy mAccuracy;
 };
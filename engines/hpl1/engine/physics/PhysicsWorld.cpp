@@ -27,6 +27,8 @@
 
 #include "hpl1/engine/physics/PhysicsWorld.h"
 
+#include "hpl1/debug.h"
+
 #include "hpl1/engine/graphics/LowLevelGraphics.h"
 #include "hpl1/engine/math/Math.h"
 #include "hpl1/engine/physics/CharacterBody.h"
@@ -52,6 +54,8 @@ namespace hpl {
 iPhysicsWorld::iPhysicsWorld() {
 	mbLogDebug = false;
 	mbSaveContactPoints = false;
+
+	ResetSimulateTimes();
 }
 
 //-----------------------------------------------------------------------
@@ -105,9 +109,18 @@ void iPhysicsWorld::Update(float afTimeStep) {
 
 	////////////////////////////////////
 	// Simulate the physics
-	// lTime = GetApplicationTime();
+	unsigned long lSimulateStart = GetApplicationTime();
 	Simulate(afTimeStep);
-	// LogUpdate(" Updating lowlevel physics took %d ms\n",mpWorld3D->GetSystem()->GetLowLevel()->GetTime() - lTime);
+	mlLastSimulateTime = GetApplicationTime() - lSimulateStart;
+
+	mlTotalSimulateTime += mlLastSimulateTime;
+	++mlSimulateCount;
+	if (mlMaxSimulateTime < mlLastSimulateTime)
+		mlMaxSimulateTime = mlLastSimulateTime;
+
+	Hpl1::logInfo(Hpl1::kDebugPhysics, "Simulating %d bodies in %d steps took %lu ms (max %lu ms, average %lu ms)\n",
+				  (int)mlstBodies.size(), GetLastSubStepCount(), mlLastSimulateTime, mlMaxSimulateTime,
+				  mlTotalSimulateTime / mlSimulateCount);
 
 	////////////////////////////////////
 	// Update the joints after simulation.
@@ -136,6 +149,15 @@ void iPhysicsWorld::Update(float afTimeStep) {
 
 //-----------------------------------------------------------------------
 
+void iPhysicsWorld::ResetSimulateTimes() {
+	mlLastSimulateTime = 0;
+	mlMaxSimulateTime = 0;
+	mlTotalSimulateTime = 0;
+	mlSimulateCount = 0;
+}
+
+//-----------------------------------------------------------------------
+
 void iPhysicsWorld::DestroyShape(iCollideShape *apShape) {
 	apShape->DecUserCount();
 	if (apShape->HasUsers() == false) {
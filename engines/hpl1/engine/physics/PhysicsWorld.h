@@ -125,6 +125,17 @@ public:
 	void Update(float afTimeStep);
 	virtual void Simulate(float afTimeStep) = 0;
 
+	/**
+	 * Number of solver steps run by the last Simulate() call.
+	 */
+	virtual int GetLastSubStepCount() { return 1; }
+
+	unsigned long GetLastSimulateTime() const { return mlLastSimulateTime; }
+	unsigned long GetMaxSimulateTime() const { return mlMaxSimulateTime; }
+	unsigned long GetTotalSimulateTime() const { return mlTotalSimulateTime; }
+	int GetSimulateCount() const { return mlSimulateCount; }
+	void ResetSimulateTimes();
+
 	virtual void SetMaxTimeStep(float afTimeStep) = 0;
 	virtual float GetMaxTimeStep() = 0;
 
@@ -266,6 +277,11 @@ protected:
 
 	tCollidePointVec mvContactPoints;
 	bool mbSaveContactPoints;
+
+	unsigned long mlLastSimulateTime;
+	unsigned long mlMaxSimulateTime;
+	unsigned long mlTotalSimulateTime;
+	int mlSimulateCount;
 };
 
 } // namespace hpl
@@ -27,6 +27,8 @@
 
 #include "hpl1/engine/scene/PortalContainer.h"
 
+#include "hpl1/debug.h"
+
 #include "hpl1/engine/graphics/RenderList.h"
 #include "hpl1/engine/graphics/Renderable.h"
 #include "hpl1/engine/math/Frustum.h"
@@ -175,6 +177,16 @@ cPortal::~cPortal() {
 
 //-----------------------------------------------------------------------
 
+void cPortal::SetActive(bool abX) {
+	if (mbActive == abX)
+		return;
+
+	mbActive = abX;
+	mpContainer->InvalidateVisibility();
+}
+
+//-----------------------------------------------------------------------
+
 void cPortal::SetTargetSector(tString asSectorId) {
 	msTargetSectorId = asSectorId;
 }
@@ -369,6 +381,7 @@ bool cSector::TryToAdd(iRenderable *apObject, bool abStatic) {
 			// if(bLog) Log("   Adding as static! Sectors: %d\n",apObject->GetRenderContainerDataList()->size());
 			// Add as static object.
 			m_setStaticObjects.insert(apObject);
+			mpContainer->InvalidateVisibility();
 
 			// Set this sector as data in the container data list.
 			// This is useful for culling later on.
@@ -638,6 +651,16 @@ cPortalContainer::cPortalContainer() {
 	mlSectorVisitCount = 0;
 
 	mlEntityIterateCount = 0;
+
+	mpCachedVisibility = NULL;
+	mlVisibilityVersion = 0;
+	mlCachedVisibilityVersion = -1;
+
+	mbVisibilityWasCached = false;
+	mlVisibleSectorNum = 0;
+	mlPortalsVisited = 0;
+	mlObjectsTested = 0;
+	mlObjectsCulled = 0;
 }
 
 //-----------------------------------------------------------------------
@@ -645,6 +668,7 @@ cPortalContainer::cPortalContainer() {
 cPortalContainer::~cPortalContainer() {
 	hplDelete(mpEntityCallback);
 	hplDelete(mpNormalEntityCallback);
+	hplDelete(mpCachedVisibility);
 
 	STLMapDeleteAll(m_mapSectors);
 }
@@ -704,6 +728,7 @@ bool cPortalContainer::Add(iRenderable *apRenderable, bool abStatic) {
 			mlstGlobalStaticObjects.push_back(apRenderable);
 			// Log("Adding as static in global\n");
 		}
+		InvalidateVisibility();
 	} else {
 		// Set the center sector to NULL
 		apRenderable->SetCurrentSector(NULL);
@@ -945,45 +970,104 @@ void cPortalContainer::AddToRenderList(iRenderable *apObject, cFrustum *apFrustu
 
 //-----------------------------------------------------------------------
 
-void cPortalContainer::GetVisible(cFrustum *apFrustum, cRenderList *apRenderList) {
-	gbCallbackActive = false;
+bool cPortalContainer::IsCachedVisibilityValid(cFrustum *apFrustum) {
+	if (mpCachedVisibility == NULL || mlCachedVisibilityVersion != mlVisibilityVersion)
+		return false;
 
-	// Clear debug
-	mlstVisibleSectors.clear();
+	if (mvCachedFrustumOrigin != apFrustum->GetOrigin())
+		return false;
 
-	////////////////////////////////////////////////
-	// Get a container with all the visible sectors
-	cSectorVisibilityContainer *pVisSectorCont = CreateVisibiltyFromFrustum(apFrustum);
+	for (int i = 0; i <= eFrustumPlane_Far; ++i) {
+		cPlanef plane = apFrustum->GetPlane((eFrustumPlane)i);
+		const cPlanef &cachedPlane = mvCachedFrustumPlanes[i];
+		if (plane.a != cachedPlane.a || plane.b != cachedPlane.b ||
+			plane.c != cachedPlane.c || plane.d != cachedPlane.d)
+			return false;
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------
 
-	// Iterate visible sectors, check for intersection with object and add the valid ones.
-	tSectorVisibilityIterator SectorIt = pVisSectorCont->GetSectorIterator();
+void cPortalContainer::UpdateCachedVisibility(cFrustum *apFrustum) {
+	hplDelete(mpCachedVisibility);
+	mpCachedVisibility = CreateVisibiltyFromFrustum(apFrustum);
+
+	mlCachedVisibilityVersion = mlVisibilityVersion;
+	mvCachedFrustumOrigin = apFrustum->GetOrigin();
+	for (int i = 0; i <= eFrustumPlane_Far; ++i)
+		mvCachedFrustumPlanes[i] = apFrustum->GetPlane((eFrustumPlane)i);
+
+	mlstVisibleSectors.clear();
+	mlstCachedStaticObjects.clear();
+
+	// Static objects never move, so the portal test only needs to be done once.
+	tSectorVisibilityIterator SectorIt = mpCachedVisibility->GetSectorIterator();
 	while (SectorIt.HasNext()) {
 		cSectorVisibility *pVisSector = SectorIt.Next();
 		cSector *pSector = pVisSector->GetSector();
 
 		mlstVisibleSectors.push_back(pSector->GetId());
 
-		//////////////////////////////////////////////////////
-		// Add all visible objects in the sector to the render list
-		// Static
 		tRenderableSetIt it = pSector->m_setStaticObjects.begin();
 		for (; it != pSector->m_setStaticObjects.end(); ++it) {
 			iRenderable *pObject = *it;
 
+			++mlObjectsTested;
 			if (pVisSector->IntersectionBV(pObject->GetBoundingVolume())) {
-				AddToRenderList(pObject, apFrustum, apRenderList);
+				mlstCachedStaticObjects.push_back(pObject);
+			} else {
+				++mlObjectsCulled;
 			}
 		}
+	}
+}
+
+//-----------------------------------------------------------------------
+
+void cPortalContainer::GetVisible(cFrustum *apFrustum, cRenderList *apRenderList) {
+	gbCallbackActive = false;
+
+	mlObjectsTested = 0;
+	mlObjectsCulled = 0;
+
+	////////////////////////////////////////////////
+	// Get a container with all the visible sectors, only recompute it if the camera
+	// or the level has changed since last time.
+	mbVisibilityWasCached = IsCachedVisibilityValid(apFrustum);
+	if (mbVisibilityWasCached == false)
+		UpdateCachedVisibility(apFrustum);
+
+	mlVisibleSectorNum = mpCachedVisibility->GetSectorNum();
+	mlPortalsVisited = mbVisibilityWasCached ? 0 : mpCachedVisibility->GetPortalsVisited();
+
+	//////////////////////////////////////////////////////
+	// Add all visible static objects to the render list
+	tRenderableListIt staticIt = mlstCachedStaticObjects.begin();
+	for (; staticIt != mlstCachedStaticObjects.end(); ++staticIt) {
+		AddToRenderList(*staticIt, apFrustum, apRenderList);
+	}
+
+	// Iterate visible sectors, check for intersection with dynamic objects and add the valid ones.
+	tSectorVisibilityIterator SectorIt = mpCachedVisibility->GetSectorIterator();
+	while (SectorIt.HasNext()) {
+		cSectorVisibility *pVisSector = SectorIt.Next();
+		cSector *pSector = pVisSector->GetSector();
+
 		// Dynamic
 		// Log("-------START------\n");
-		it = pSector->m_setDynamicObjects.begin();
+		tRenderableSetIt it = pSector->m_setDynamicObjects.begin();
 		for (; it != pSector->m_setDynamicObjects.end(); ++it) {
 			iRenderable *pObject = *it;
 
 			// Log("Checking %d\n",(size_t)pObject);
 
+			++mlObjectsTested;
 			if (pVisSector->IntersectionBV(pObject->GetBoundingVolume())) {
 				AddToRenderList(pObject, apFrustum, apRenderList);
+			} else {
+				++mlObjectsCulled;
 			}
 		}
 		// Log("------END-------\n");
@@ -1015,8 +1099,8 @@ void cPortalContainer::GetVisible(cFrustum *apFrustum, cRenderList *apRenderList
 		}
 	}
 
-	// Delete visible sectors.
-	hplDelete(pVisSectorCont);
+	Hpl1::logInfo(Hpl1::kDebugRenderer, "Portal visibility%s: %d sectors, %d portals visited, %d of %d objects culled\n",
+				  mbVisibilityWasCached ? " (cached)" : "", mlVisibleSectorNum, mlPortalsVisited, mlObjectsCulled, mlObjectsTested);
 
 	gbCallbackActive = true;
 }
@@ -1026,6 +1110,8 @@ void cPortalContainer::GetVisible(cFrustum *apFrustum, cRenderList *apRenderList
 void cPortalContainer::Compile() {
 	/*When octrees are used, they should be compiled here */
 
+	InvalidateVisibility();
+
 	////////////////////////////////////////////////////////
 	// Go through all normal entities and update them
 	//(this since sectors might have been created  after their creation).
@@ -1064,6 +1150,8 @@ void cPortalContainer::AddSector(tString asId) {
 	cSector *pSector = hplNew(cSector, (asId, this));
 
 	m_mapSectors.insert(tSectorMap::value_type(asId, pSector));
+
+	InvalidateVisibility();
 }
 
 //-----------------------------------------------------------------------
@@ -1078,6 +1166,7 @@ bool cPortalContainer::AddToSector(iRenderable *apRenderable, tString asSector)
 	cSector *pSector = it->second;
 
 	pSector->m_setStaticObjects.insert(apRenderable);
+	InvalidateVisibility();
 
 	// Setting the sector is useful for some culling.
 	apRenderable->GetRenderContainerDataList()->push_back(pSector);
@@ -1125,6 +1214,7 @@ bool cPortalContainer::AddPortal(cPortal *apPortal, tString asSector) {
 	cSector *pSector = it->second;
 
 	pSector->AddPortal(apPortal);
+	InvalidateVisibility();
 
 	return true;
 }
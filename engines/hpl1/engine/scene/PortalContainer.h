@@ -31,6 +31,7 @@
 #include "common/list.h"
 #include "hpl1/engine/graphics/Renderable.h"
 #include "hpl1/engine/math/BoundingVolume.h"
+#include "hpl1/engine/math/Frustum.h"
 #include "hpl1/engine/scene/RenderableContainer.h"
 #include "common/stablemap.h"
 #include "hpl1/std/set.h"
@@ -152,7 +153,7 @@ public:
 	cPlanef &GetPlane() { return mPlane; }
 
 	bool GetActive() { return mbActive; }
-	void SetActive(bool abX) { mbActive = abX; }
+	void SetActive(bool abX);
 
 private:
 	cPortalContainer *mpContainer;
@@ -270,6 +271,21 @@ public:
 
 	int GetSectorVisitCount() const { return mlSectorVisitCount; }
 
+	/**
+	 * Makes the next GetVisible() recompute the sector visibility. Must be called when sectors, portals
+	 * or static objects change.
+	 */
+	void InvalidateVisibility() { ++mlVisibilityVersion; }
+
+	/**
+	 * Statistics of the last GetVisible() call.
+	 */
+	bool GetVisibilityWasCached() const { return mbVisibilityWasCached; }
+	int GetVisibleSectorNum() const { return mlVisibleSectorNum; }
+	int GetPortalsVisited() const { return mlPortalsVisited; }
+	int GetObjectsTested() const { return mlObjectsTested; }
+	int GetObjectsCulled() const { return mlObjectsCulled; }
+
 	cPortalContainerEntityIterator GetEntityIterator(cBoundingVolume *apBV);
 
 	// Visibility tools
@@ -286,6 +302,9 @@ public:
 private:
 	void ComputeSectorVisibilty(cSectorVisibilityContainer *apContainer);
 
+	bool IsCachedVisibilityValid(cFrustum *apFrustum);
+	void UpdateCachedVisibility(cFrustum *apFrustum);
+
 	tSectorMap m_mapSectors;
 
 	int mlSectorVisitCount;
@@ -304,6 +323,22 @@ private:
 	tStringList mlstVisibleSectors;
 
 	int mlEntityIterateCount;
+
+	// Sector visibility only depends on the frustum and the static layout, so it is
+	// kept until either changes. Static objects that passed the portal test are kept
+	// with it, dynamic objects are tested every frame.
+	cSectorVisibilityContainer *mpCachedVisibility;
+	int mlVisibilityVersion;
+	int mlCachedVisibilityVersion;
+	cVector3f mvCachedFrustumOrigin;
+	cPlanef mvCachedFrustumPlanes[eFrustumPlane_Far + 1];
+	tRenderableList mlstCachedStaticObjects;
+
+	bool mbVisibilityWasCached;
+	int mlVisibleSectorNum;
+	int mlPortalsVisited;
+	int mlObjectsTested;
+	int mlObjectsCulled;
 };
 
 } // namespace hpl
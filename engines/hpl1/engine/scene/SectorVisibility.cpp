@@ -176,6 +176,7 @@ cSectorVisibilityContainer::cSectorVisibilityContainer(eSectorVisibilityType aTy
 
 	mbLog = false;
 	mlTabs = 0;
+	mlPortalsVisited = 0;
 }
 
 cSectorVisibilityContainer::~cSectorVisibilityContainer() {
@@ -308,6 +309,8 @@ void cSectorVisibilityContainer::SearchSector(cSector *apSector, cPortalVisibili
 		cPortal *pPortal = *it;
 		cSector *pTargetSector = pPortal->GetTargetSector();
 
+		++mlPortalsVisited;
+
 		// Check if it is a start sector
 		if (m_setStartSectors.find(pTargetSector) != m_setStartSectors.end()) {
 			continue;
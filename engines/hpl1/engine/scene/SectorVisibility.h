@@ -153,6 +153,9 @@ public:
 
 	bool IntersectionBV(cBoundingVolume *apBV, cPortalVisibilitySet *apSet);
 
+	int GetSectorNum() const { return (int)m_mapSectors.size(); }
+	int GetPortalsVisited() const { return mlPortalsVisited; }
+
 	bool mbLog;
 
 private:
@@ -174,6 +177,7 @@ private:
 	cFrustum mFrustum;
 
 	int mlTabs;
+	int mlPortalsVisited;
 };
 
 //----------------------------------------------------
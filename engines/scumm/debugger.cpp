@@ -297,6 +297,9 @@ bool ScummDebugger::Cmd_DiMuse(int argc, const char **argv) {
 		} else if (!strcmp(argv[1], "groups") || !strcmp(argv[1], "vols")) {
 			_vm->_imuseDigital->listGroups();
 			return true;
+		} else if (!strcmp(argv[1], "streams")) {
+			_vm->_imuseDigital->listStreamStats();
+			return true;
 		} else if (!strcmp(argv[1], "getParam")) {
 			if (argc > 3) {
 				int result = _vm->_imuseDigital->diMUSEGetParam(atoi(argv[2]), strtol(argv[3], NULL, 16));
@@ -356,6 +359,7 @@ bool ScummDebugger::Cmd_DiMuse(int argc, const char **argv) {
 	debugPrintf("\thook <soundId> <hookId>          - Set hookId for a sound\n");
 	debugPrintf("\tlist|tracks                      - Display info for every virtual audio track\n");
 	debugPrintf("\tgroups|vols                      - Show volume groups info\n");
+	debugPrintf("\tstreams                          - Show streamer underruns and bundle block cache stats\n");
 	debugPrintf("\tgetParam <soundId> <param>       - Get parameter info from a sound\n");
 	debugPrintf("\tsetParam <soundId> <param> <val> - Set parameter value for a sound (dangerous!)\n");
 	debugPrintf("\n");
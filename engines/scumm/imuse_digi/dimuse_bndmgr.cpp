@@ -37,6 +37,10 @@ BundleDirCache::BundleDirCache(const ScummEngine *vm) : _vm(vm) {
 		_bundleDirCache[fileId].isCompressed = false;
 		_bundleDirCache[fileId].indexTable = nullptr;
 	}
+
+	_blockCacheStats.hits = 0;
+	_blockCacheStats.misses = 0;
+	_blockCacheStats.prefetched = 0;
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -148,6 +152,7 @@ BundleMgr::BundleMgr(const ScummEngine *vm, BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile(vm);
 	_compInputBuff = nullptr;
+	resetDecodedBlocks();
 }
 
 BundleMgr::~BundleMgr() {
@@ -193,10 +198,9 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_isUncompressed = false;
-	_outputSize = 0;
 	_lastBlockDecompressedSize = 0;
 	_curDecompressedFilePos = 0;
-	_lastBlock = -1;
+	resetDecodedBlocks();
 
 	return true;
 }
@@ -211,9 +215,8 @@ void BundleMgr::close() {
 		_curDecompressedFilePos = 0;
 		_compTableLoaded = false;
 		_isUncompressed = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
+		resetDecodedBlocks();
 		free(_compTable);
 		_compTable = nullptr;
 		free(_compInputBuff);
@@ -257,6 +260,73 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+void BundleMgr::resetDecodedBlocks() {
+	for (int i = 0; i < DIMUSE_BUN_CACHED_BLOCKS; i++) {
+		_decodedBlocks[i].block = -1;
+		_decodedBlocks[i].size = 0;
+		_decodedBlocks[i].lastUsed = 0;
+	}
+	_decodedBlocksClock = 0;
+}
+
+BundleMgr::DecodedBlock *BundleMgr::decodeBlock(int32 block, bool prefetch) {
+	BundleDirCache::BlockCacheStats &stats = _cache->getBlockCacheStats();
+	DecodedBlock *victim = &_decodedBlocks[0];
+
+	for (int i = 0; i < DIMUSE_BUN_CACHED_BLOCKS; i++) {
+		DecodedBlock *entry = &_decodedBlocks[i];
+		if (entry->block == block) {
+			if (!prefetch) {
+				entry->lastUsed = ++_decodedBlocksClock;
+				stats.hits++;
+			}
+			return entry;
+		}
+
+		if (entry->lastUsed < victim->lastUsed)
+			victim = entry;
+	}
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[_curSampleId].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	victim->size = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, victim->data, _compTable[block].size);
+
+	if (victim->size > DIMUSE_BUN_CHUNK_SIZE) {
+		error("BundleMgr::decodeBlock(): block %d decompressed to %d bytes", block, victim->size);
+	}
+
+	victim->block = block;
+	victim->lastUsed = ++_decodedBlocksClock;
+
+	if (prefetch) {
+		stats.prefetched++;
+	} else {
+		stats.misses++;
+	}
+
+	return victim;
+}
+
+void BundleMgr::prefetchBlocks(int32 size) {
+	if (!_file->isOpen() || !_compTableLoaded || _isUncompressed || _curSampleId == -1 || size <= 0)
+		return;
+
+	int32 firstBlock = _curDecompressedFilePos / DIMUSE_BUN_CHUNK_SIZE;
+	int32 lastBlock = (_curDecompressedFilePos + size - 1) / DIMUSE_BUN_CHUNK_SIZE;
+
+	// Leave one slot for the block which is currently being consumed
+	if (lastBlock > firstBlock + DIMUSE_BUN_CACHED_BLOCKS - 2)
+		lastBlock = firstBlock + DIMUSE_BUN_CACHED_BLOCKS - 2;
+
+	if (lastBlock >= _numCompItems)
+		lastBlock = _numCompItems - 1;
+
+	for (int32 i = firstBlock; i <= lastBlock; i++)
+		decodeBlock(i, true);
+}
+
 int32 BundleMgr::seekFile(int32 offset, int mode) {
 	// We don't actually seek the file, but instead try to find that the specified offset exists
 	// within the decompressed blocks, and save that offset in _curDecompressedFilePos
@@ -349,20 +419,9 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 		skip = (_curDecompressedFilePos + headerSize) % DIMUSE_BUN_CHUNK_SIZE; // Excess length after the last block
 
 		for (i = firstBlock; i <= lastBlock; i++) {
-			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
-				}
-				_lastBlock = i;
-			}
+			DecodedBlock *decoded = decodeBlock(i, false);
 
-			outputSize = _outputSize;
+			outputSize = decoded->size;
 
 			if (header_outside) {
 				outputSize -= skip;
@@ -379,7 +438,7 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 			assert(finalSize + outputSize <= blocksFinalSize);
 
-			memcpy(*comp_final + finalSize, _compOutputBuff + skip, outputSize);
+			memcpy(*comp_final + finalSize, decoded->data + skip, outputSize);
 			finalSize += outputSize;
 
 			size -= outputSize;
@@ -43,6 +43,12 @@ public:
 		int32 index;
 	};
 
+	struct BlockCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 prefetched;
+	};
+
 private:
 
 	struct FileDirCache {
@@ -53,6 +59,8 @@ private:
 		IndexNode *indexTable;
 	} _bundleDirCache[4];
 
+	BlockCacheStats _blockCacheStats;
+
 	const ScummEngine *_vm;
 public:
 	BundleDirCache(const ScummEngine *vm);
@@ -63,6 +71,7 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+	BlockCacheStats &getBlockCacheStats() { return _blockCacheStats; }
 };
 
 class BundleMgr {
@@ -74,6 +83,15 @@ private:
 		int32 codec;
 	};
 
+	// Decompressed blocks are kept in a small LRU cache, which the streamer
+	// fills ahead of playback through prefetchBlocks()
+	struct DecodedBlock {
+		int32 block;
+		int32 size;
+		uint32 lastUsed;
+		byte data[DIMUSE_BUN_CHUNK_SIZE];
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable = nullptr;
@@ -88,11 +106,12 @@ private:
 	bool _compTableLoaded = 0;
 	bool _isUncompressed = 0;
 	int _fileBundleId = 0;
-	byte _compOutputBuff[0x2000] = {};
 	byte *_compInputBuff = nullptr;
-	int _outputSize = 0;
-	int _lastBlock = 0;
+	DecodedBlock _decodedBlocks[DIMUSE_BUN_CACHED_BLOCKS];
+	uint32 _decodedBlocksClock = 0;
 	bool loadCompTable(int32 index);
+	void resetDecodedBlocks();
+	DecodedBlock *decodeBlock(int32 block, bool prefetch);
 
 public:
 
@@ -104,6 +123,7 @@ public:
 	Common::SeekableReadStream *getFile(const char *filename, int32 &offset, int32 &size);
 	int32 seekFile(int32 offset, int size);
 	int32 readFile(const char *name, int32 size, byte **compFinal, bool headerOutside);
+	void prefetchBlocks(int32 size);
 	bool isExtCompBun(byte gameId);
 };
 
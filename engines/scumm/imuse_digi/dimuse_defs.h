@@ -45,6 +45,7 @@ namespace Scumm {
 #define DIMUSE_NUM_WAVE_BUFS   8
 #define DIMUSE_SMUSH_SOUNDID   12345678
 #define DIMUSE_BUN_CHUNK_SIZE  0x2000
+#define DIMUSE_BUN_CACHED_BLOCKS 4
 #define DIMUSE_GROUP_SFX       1
 #define DIMUSE_GROUP_SPEECH    2
 #define DIMUSE_GROUP_MUSIC     3
@@ -614,6 +614,10 @@ void IMuseDigital::dispatchProcessDispatches(IMuseDigiTrack *trackPtr, int feedS
 		if (dispatchPtr->streamPtr) {
 			srcBuf = streamerGetStreamBuffer(dispatchPtr->streamPtr, effRemainingAudio);
 			if (!srcBuf) {
+				// A paused stream has simply reached the end of its data
+				if (!dispatchPtr->streamPtr->paused)
+					_streamerUnderrunCount++;
+
 				dispatchPtr->streamErrFlag = 1;
 				if (dispatchPtr->fadeBuf && dispatchPtr->fadeSyncFlag)
 					dispatchPtr->fadeSyncDelta += feedSize;
@@ -777,6 +781,9 @@ void IMuseDigital::dispatchProcessDispatches(IMuseDigiTrack *trackPtr, int feedS
 		if (streamPtr) {
 			buffer = streamerGetStreamBuffer(streamPtr, inFrameCount);
 			if (!buffer) {
+				if (!streamPtr->paused)
+					_streamerUnderrunCount++;
+
 				if (dispatchPtr->fadeBuf)
 					dispatchPtr->fadeSyncDelta += fadeChunkSize;
 				return;
@@ -1111,6 +1111,21 @@ void IMuseDigital::listTracks() {
 	_vm->getDebugger()->debugPrintf("+---+---------+-------+-----------+-----------------+----------+----------+\n\n");
 }
 
+void IMuseDigital::listStreamStats() {
+	_vm->getDebugger()->debugPrintf("Streamer:\n");
+	_vm->getDebugger()->debugPrintf("\tUnderruns:        %u\n", _streamerUnderrunCount);
+	if (isFTSoundEngine()) {
+		_vm->getDebugger()->debugPrintf("\tNo bundle block cache for this game.\n\n");
+		return;
+	}
+
+	BundleDirCache::BlockCacheStats &stats = _filesHandler->getBlockCacheStats();
+	_vm->getDebugger()->debugPrintf("Bundle block cache:\n");
+	_vm->getDebugger()->debugPrintf("\tHits:             %u\n", stats.hits);
+	_vm->getDebugger()->debugPrintf("\tMisses:           %u\n", stats.misses);
+	_vm->getDebugger()->debugPrintf("\tPrefetched:       %u\n\n", stats.prefetched);
+}
+
 void IMuseDigital::listGroups() {
 	_vm->getDebugger()->debugPrintf("Volume groups:\n");
 	_vm->getDebugger()->debugPrintf("\tSFX:      %3d\n", _groupsHandler->getGroupVol(DIMUSE_GROUP_SFX));
@@ -173,6 +173,7 @@ private:
 	IMuseDigiStream _streams[DIMUSE_MAX_STREAMS];
 	IMuseDigiStream *_lastStreamLoaded;
 	int _streamerBailFlag;
+	uint32 _streamerUnderrunCount;
 
 	int streamerInit();
 	IMuseDigiStream *streamerAllocateSound(int soundId, int bufId, int32 maxRead);
@@ -439,6 +440,7 @@ public:
 	void listCues();
 	void listTracks();
 	void listGroups();
+	void listStreamStats();
 };
 
 } // End of namespace Scumm
@@ -256,6 +256,24 @@ int IMuseDigiFilesHandler::read(int soundId, uint8 *buf, int32 size, int bufId)
 	return 0;
 }
 
+void IMuseDigiFilesHandler::prefetch(int soundId, int32 size) {
+	// Only DIG & COMI stream their audio from compressed bundles,
+	// and SAN cutscenes in DIG don't go through the bundle manager
+	if (_engine->isEngineDisabled() || _engine->isFTSoundEngine() || soundId == 0)
+		return;
+
+	if ((_vm->_game.id == GID_DIG && !(_vm->_game.features & GF_DEMO)) && (soundId > kTalkSoundID))
+		return;
+
+	ImuseDigiSndMgr::SoundDesc *s = _sound->findSoundById(soundId);
+	if (s && s->inUse && s->bundle)
+		s->bundle->prefetchBlocks(size);
+}
+
+BundleDirCache::BlockCacheStats &IMuseDigiFilesHandler::getBlockCacheStats() {
+	return _sound->getBlockCacheStats();
+}
+
 IMuseDigiSndBuffer *IMuseDigiFilesHandler::getBufInfo(int bufId) {
 	if (bufId > 0 && bufId <= 4) {
 		return &_soundBuffers[bufId];
@@ -236,6 +236,10 @@ ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::getSounds() {
 	return _sounds;
 }
 
+BundleDirCache::BlockCacheStats &ImuseDigiSndMgr::getBlockCacheStats() {
+	return _cacheBundleDir->getBlockCacheStats();
+}
+
 void ImuseDigiSndMgr::scheduleSoundForDeallocation(int soundId) {
 	SoundDesc *soundDesc = nullptr;
 	for (int i = 0; i < MAX_IMUSE_SOUNDS; i++) {
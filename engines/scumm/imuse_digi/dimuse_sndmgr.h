@@ -24,6 +24,7 @@
 
 
 #include "common/scummsys.h"
+#include "scumm/imuse_digi/dimuse_bndmgr.h"
 
 namespace Audio {
 class SeekableAudioStream;
@@ -36,8 +37,6 @@ class SeekableReadStream;
 namespace Scumm {
 
 class ScummEngine;
-class BundleMgr;
-class BundleDirCache;
 
 class ImuseDigiSndMgr {
 public:
@@ -88,6 +87,7 @@ public:
 	void closeSoundById(int soundId);
 	SoundDesc *findSoundById(int soundId);
 	SoundDesc *getSounds();
+	BundleDirCache::BlockCacheStats &getBlockCacheStats();
 	void scheduleSoundForDeallocation(int soundId);
 
 };
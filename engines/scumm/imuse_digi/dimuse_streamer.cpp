@@ -28,6 +28,7 @@ int IMuseDigital::streamerInit() {
 		_streams[l].soundId = 0;
 	}
 	_lastStreamLoaded = nullptr;
+	_streamerUnderrunCount = 0;
 	return 0;
 }
 
@@ -215,6 +216,9 @@ int IMuseDigital::streamerGetFreeBufferAmount(IMuseDigiStream *streamPtr) {
 }
 
 int IMuseDigital::streamerSetSoundToStreamFromOffset(IMuseDigiStream *streamPtr, int soundId, int32 offset) {
+	// The files handler is shared with the streamer fetches and the prefetch below
+	Common::StackLock lock(*_mutex);
+
 	_streamerBailFlag = 1;
 	streamPtr->soundId = soundId;
 	streamPtr->curOffset = offset;
@@ -223,6 +227,11 @@ int IMuseDigital::streamerSetSoundToStreamFromOffset(IMuseDigiStream *streamPtr,
 	if (_lastStreamLoaded == streamPtr) {
 		_lastStreamLoaded = nullptr;
 	}
+
+	// The dispatcher jumps to a new region whenever a hook or trigger fires:
+	// decode its first blocks right away, instead of during the next fetch
+	if (!_isEarlyDiMUSE && _filesHandler->seek(soundId, offset, SEEK_SET, streamPtr->bufId) == offset)
+		_filesHandler->prefetch(soundId, streamPtr->loadSize);
 	return 0;
 }
 
@@ -338,6 +347,11 @@ int IMuseDigital::streamerFetchData(IMuseDigiStream *streamPtr) {
 
 		_mutex->lock();
 		actualAmount = _filesHandler->read(streamPtr->soundId, &streamPtr->buf[streamPtr->loadIndex], requestedAmount, streamPtr->bufId);
+
+		// Decompress the blocks for the next fetch ahead of time, so that
+		// reading them back doesn't stall the stream when it's running low
+		if (!_isEarlyDiMUSE && actualAmount == requestedAmount)
+			_filesHandler->prefetch(streamPtr->soundId, streamPtr->loadSize);
 		_mutex->unlock();
 
 		// FT has no bailFlag
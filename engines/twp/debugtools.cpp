@@ -483,6 +483,9 @@ static void drawGeneral() {
 			ImGui::TextColored(gray, "Height:");
 			ImGui::SameLine();
 			ImGui::Text("%d", room->_height);
+			ImGui::TextColored(gray, "Paths:");
+			ImGui::SameLine();
+			ImGui::Text("%u (%u graphs built)", room->_pathFinder.getPathCount(), room->_pathFinder.getGraphBuildCount());
 			Color overlay = room->_overlayNode.getOverlayColor();
 			if (ImGui::ColorEdit4("Overlay", overlay.v))
 				room->_overlayNode.setOverlayColor(overlay);
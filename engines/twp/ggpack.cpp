@@ -372,13 +372,18 @@ static bool _readPlo(Common::SeekableReadStream *s, Common::Array<int> &offsets)
 }
 
 Common::String GGHashMapDecoder::readString(uint32 i) {
-	Common::String result;
+	// The same few keys are used by thousands of entries, decode each string once.
+	if (_decoded[i])
+		return _strings[i];
+
+	Common::String &result = _strings[i];
 	int64 pos = _stream->pos();
 	_stream->seek(_offsets[i]);
 	while (true) {
 		byte c = _stream->readByte();
 		if (c == 0) {
 			_stream->seek(pos);
+			_decoded[i] = true;
 			return result;
 		}
 		result += (char)c;
@@ -460,8 +465,13 @@ Common::JSONValue *GGHashMapDecoder::open(Common::SeekableReadStream *s) {
 	_stream = s;
 	/*uint32 numEntries =*/(void)s->readUint32LE();
 
+	_offsets.clear();
 	if (!_readPlo(s, _offsets))
 		return nullptr;
+	_strings.clear();
+	_strings.resize(_offsets.size());
+	_decoded.clear();
+	_decoded.resize(_offsets.size());
 	return readHash();
 }
 
@@ -593,13 +603,24 @@ bool XorStream::open(Common::SeekableReadStream *stream, int len, const XorKey &
 uint32 XorStream::read(void *dataPtr, uint32 dataSize) {
 	int p = (int)pos();
 	uint32 result = _s->read(dataPtr, dataSize);
-	char *buf = (char *)dataPtr;
-	for (size_t i = 0; i < dataSize; i++) {
-		int x = buf[i] ^ _key.magicBytes[p & 0x0F] ^ (i * _key.multiplier);
-		buf[i] = (char)(x ^ _previous);
-		_previous = x;
-		p++;
-	}
+
+	// Only the low byte of each value matters, so work on bytes and keep the
+	// key in a local table instead of indexing the key array for every byte.
+	byte magic[16];
+	for (int i = 0; i < 16; i++)
+		magic[i] = (byte)_key.magicBytes[(p + i) & 0x0F];
+	const byte multiplier = (byte)_key.multiplier;
+
+	byte *buf = (byte *)dataPtr;
+	byte previous = (byte)_previous;
+	byte mask = 0;
+	for (uint32 i = 0; i < dataSize; i++) {
+		const byte x = buf[i] ^ magic[i & 0x0F] ^ mask;
+		buf[i] = x ^ previous;
+		previous = x;
+		mask += multiplier;
+	}
+	_previous = previous;
 	return result;
 }
 
@@ -665,9 +686,10 @@ bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key) {
 GGPackEntryReader::GGPackEntryReader() {}
 
 bool GGPackEntryReader::open(GGPackDecoder &pack, const Common::String &entry) {
-	if (!pack._entries.contains(entry))
+	GGPackEntries::const_iterator it = pack._entries.find(entry);
+	if (it == pack._entries.end())
 		return false;
-	GGPackEntry e = pack._entries[entry];
+	const GGPackEntry &e = it->_value;
 	pack._s->seek(e.offset);
 
 	RangeStream rs;
@@ -765,9 +787,9 @@ void GGPackSet::init(const XorKey &key) {
 }
 
 bool GGPackSet::assetExists(const char *asset) {
-	for (size_t i = 0; i < _packs.size(); i++) {
-		GGPackDecoder *pack = &_packs[i];
-		if (pack->assetExists(asset))
+	const Common::String name(asset);
+	for (auto it = _packs.begin(); it != _packs.end(); it++) {
+		if (it->second.assetExists(name))
 			return true;
 	}
 	return false;
@@ -127,6 +127,8 @@ private:
 private:
 	Common::SeekableReadStream *_stream = nullptr;
 	Common::Array<int> _offsets;
+	Common::Array<Common::String> _strings; // Strings already decoded, by offset index
+	Common::Array<bool> _decoded;
 };
 
 class GGHashMapEncoder {
@@ -169,7 +171,7 @@ public:
 
 	bool open(Common::SeekableReadStream *s, const XorKey &key);
 
-	bool assetExists(const char *asset) { return _entries.contains(asset); }
+	bool assetExists(const Common::String &asset) const { return _entries.contains(asset); }
 
 private:
 	XorKey _key;
@@ -24,45 +24,57 @@
 namespace Twp {
 
 IndexedPriorityQueue::IndexedPriorityQueue(Common::Array<float> &keys)
-	: _keys(keys) {
+	: _keys(keys), _positions(keys.size(), -1) {
 }
 
 void IndexedPriorityQueue::insert(int index) {
 	_data.push_back(index);
-	reorderUp();
+	_positions[index] = _data.size() - 1;
+	reorderUp(_data.size() - 1);
 }
 
 int IndexedPriorityQueue::pop() {
 	int r = _data[0];
-	_data[0] = _data[_data.size() - 1];
+	swap(0, _data.size() - 1);
 	_data.pop_back();
-	reorderDown();
+	_positions[r] = -1;
+	reorderDown(0);
 	return r;
 }
 
-void IndexedPriorityQueue::reorderUp() {
-	if (_data.empty())
-		return;
-	size_t a = _data.size() - 1;
-	while (a > 0) {
-		if (_keys[_data[a]] >= _keys[_data[a - 1]])
+void IndexedPriorityQueue::decreaseKey(int index) {
+	if (_positions[index] >= 0)
+		reorderUp(_positions[index]);
+}
+
+void IndexedPriorityQueue::swap(uint a, uint b) {
+	SWAP(_data[a], _data[b]);
+	_positions[_data[a]] = a;
+	_positions[_data[b]] = b;
+}
+
+void IndexedPriorityQueue::reorderUp(uint pos) {
+	while (pos > 0) {
+		uint parent = (pos - 1) / 2;
+		if (_keys[_data[pos]] >= _keys[_data[parent]])
 			return;
-		int tmp = _data[a];
-		_data[a] = _data[a - 1];
-		_data[a - 1] = tmp;
-		a--;
+		swap(pos, parent);
+		pos = parent;
 	}
 }
 
-void IndexedPriorityQueue::reorderDown() {
-	if (_data.empty())
-		return;
-	for (int a = 0; a < static_cast<int>(_data.size() - 1); a++) {
-		if (_keys[_data[a]] <= _keys[_data[a + 1]])
+void IndexedPriorityQueue::reorderDown(uint pos) {
+	const uint size = _data.size();
+	while (true) {
+		uint child = 2 * pos + 1;
+		if (child >= size)
+			return;
+		if ((child + 1 < size) && (_keys[_data[child + 1]] < _keys[_data[child]]))
+			child++;
+		if (_keys[_data[pos]] <= _keys[_data[child]])
 			return;
-		int tmp = _data[a];
-		_data[a] = _data[a + 1];
-		_data[a + 1] = tmp;
+		swap(pos, child);
+		pos = child;
 	}
 }
 
@@ -92,22 +104,27 @@ void AStar::search(int source, int target) {
 	while (!pq.isEmpty()) {
 		int NCN = pq.pop();
 		_spt[NCN] = _sf[NCN];
-		if (NCN != target) {
-			for (size_t i = 0; i < _graph->_edges[NCN].size(); i++) {
-				GraphEdge &edge = _graph->_edges[NCN][i];
-				float Hcost = length(_graph->_nodes[edge.to] - _graph->_nodes[target]);
-				float Gcost = _gCost[NCN] + edge.cost;
-				if (!_sf[edge.to]) {
-					_fCost[edge.to] = Gcost + Hcost;
-					_gCost[edge.to] = Gcost;
-					pq.insert(edge.to);
-					_sf[edge.to] = &edge;
-				} else if (Gcost < _gCost[edge.to] && !_spt[edge.to]) {
-					_fCost[edge.to] = Gcost + Hcost;
-					_gCost[edge.to] = Gcost;
-					pq.reorderUp();
-					_sf[edge.to] = &edge;
-				}
+		// The heuristic never overestimates, so the first time the target
+		// leaves the queue its path is the shortest one.
+		if (NCN == target)
+			return;
+
+		for (size_t i = 0; i < _graph->_edges[NCN].size(); i++) {
+			GraphEdge &edge = _graph->_edges[NCN][i];
+			if (edge.to == source)
+				continue;
+			float Hcost = length(_graph->_nodes[edge.to] - _graph->_nodes[target]);
+			float Gcost = _gCost[NCN] + edge.cost;
+			if (!_sf[edge.to]) {
+				_fCost[edge.to] = Gcost + Hcost;
+				_gCost[edge.to] = Gcost;
+				pq.insert(edge.to);
+				_sf[edge.to] = &edge;
+			} else if (Gcost < _gCost[edge.to] && !_spt[edge.to]) {
+				_fCost[edge.to] = Gcost + Hcost;
+				_gCost[edge.to] = Gcost;
+				pq.decreaseKey(edge.to);
+				_sf[edge.to] = &edge;
 			}
 		}
 	}
@@ -149,8 +166,14 @@ Common::Array<int> Graph::getPath(int source, int target) {
 	return result;
 }
 
-void PathFinder::setWalkboxes(const Common::Array<Walkbox> &walkboxes) {
+void PathFinder::setWalkboxes(const Common::Array<Walkbox> &walkboxes, const Common::String &key) {
 	_walkboxes = walkboxes;
+	_walkboxIds.resize(walkboxes.size());
+	for (uint i = 0; i < walkboxes.size(); i++)
+		_walkboxIds[i] = i;
+	if (key.empty() || (key != _key && _graphs.size() >= 32))
+		_graphs.clear();
+	_key = key;
 	_graph = nullptr;
 }
 
@@ -272,6 +295,7 @@ Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s,
 			if (wb.contains(start) && (i != 0)) {
 				_graph.reset();
 				SWAP(_walkboxes[0], _walkboxes[i]);
+				SWAP(_walkboxIds[0], _walkboxIds[i]);
 				break;
 			}
 		}
@@ -288,11 +312,20 @@ Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s,
 			if (index != 0) {
 				_graph.reset();
 				SWAP(_walkboxes[0], _walkboxes[index]);
+				SWAP(_walkboxIds[0], _walkboxIds[index]);
 			}
 		}
 
-		if (!_graph)
-			_graph = createGraph();
+		// the graph only depends on the walkboxes and on which one the actor is in
+		if (!_graph) {
+			const Common::String graphKey = Common::String::format("%s:%d", _key.c_str(), _walkboxIds[0]);
+			if (!_graphs.tryGetVal(graphKey, _graph)) {
+				_graph = createGraph();
+				_graphs[graphKey] = _graph;
+				_graphBuildCount++;
+			}
+		}
+		_pathCount++;
 
 		// create new node on start position
 		_walkgraph = *_graph;
@@ -23,6 +23,8 @@
 #define TWP_GRAPH_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "math/vector2d.h"
 #include "twp/util.h"
 
@@ -34,15 +36,20 @@ public:
 
 	void insert(int index);
 	int pop();
-
-	void reorderUp();
-	void reorderDown();
+	// Restores the order after the key of a queued index has decreased.
+	void decreaseKey(int index);
 
 	bool isEmpty();
 
+private:
+	void reorderUp(uint pos);
+	void reorderDown(uint pos);
+	void swap(uint a, uint b);
+
 private:
 	Common::Array<float> &_keys;
-	Common::Array<int> _data;
+	Common::Array<int> _data;      // Binary heap of indices, the one with the lowest key first
+	Common::Array<int> _positions; // Position of each index in the heap or -1
 };
 
 // An edge is a part of a walkable area, it is used by a Graph.
@@ -110,12 +117,15 @@ private:
 // A PathFinder is used to find a walkable path within one or several walkboxes.
 class PathFinder {
 public:
-	void setWalkboxes(const Common::Array<Walkbox> &walkboxes);
+	// Sets the walkable area, graphs built earlier for the same key are reused.
+	void setWalkboxes(const Common::Array<Walkbox> &walkboxes, const Common::String &key = Common::String());
 	Common::Array<Walkbox> getWalkboxes() const { return _walkboxes; }
 	Common::Array<Math::Vector2d> calculatePath(const Math::Vector2d &start, const Math::Vector2d &to);
 	void setDirty(bool dirty) { _isDirty = dirty; }
 	bool isDirty() const { return _isDirty; }
 	const Graph &getGraph() const { return _walkgraph; }
+	uint32 getPathCount() const { return _pathCount; }
+	uint32 getGraphBuildCount() const { return _graphBuildCount; }
 
 private:
 	Common::SharedPtr<Graph> createGraph();
@@ -123,9 +133,14 @@ private:
 
 private:
 	Common::Array<Walkbox> _walkboxes;
+	Common::Array<int> _walkboxIds; // Index each walkbox had when set, follows the walkboxes when reordered
+	Common::String _key;
+	Common::HashMap<Common::String, Common::SharedPtr<Graph> > _graphs; // Graphs by key and walkbox the actor is in
 	Common::SharedPtr<Graph> _graph;
 	Graph _walkgraph;
 	bool _isDirty = true;
+	uint32 _pathCount = 0;
+	uint32 _graphBuildCount = 0;
 };
 
 } // namespace Twp
@@ -109,6 +109,14 @@ static Walkbox toWalkbox(const ClipperLib::Path &path) {
 	return Walkbox(pts, ClipperLib::Orientation(path));
 }
 
+// Identifies which walkboxes are visible, merging the same walkboxes always gives the same result.
+static Common::String visibilityKey(const Common::Array<Walkbox> &walkboxes) {
+	Common::String key;
+	for (size_t i = 0; i < walkboxes.size(); i++)
+		key += walkboxes[i].isVisible() ? '1' : '0';
+	return key;
+}
+
 static Common::Array<Walkbox> merge(const Common::Array<Walkbox> &walkboxes) {
 	Common::Array<Walkbox> result;
 	if (walkboxes.size() > 0) {
@@ -359,6 +367,7 @@ void Room::load(Common::SharedPtr<Room> room, Common::SeekableReadStream &s) {
 	}
 
 	room->_mergedPolygon = merge(room->_walkboxes);
+	room->_mergedPolygons[visibilityKey(room->_walkboxes)] = room->_mergedPolygon;
 
 	// Fix room size (why ?)
 	int width = 0;
@@ -471,8 +480,13 @@ void Room::walkboxHidden(const Common::String &name, bool hidden) {
 Common::Array<Math::Vector2d> Room::calculatePath(const Math::Vector2d &frm, const Math::Vector2d &to) {
 	if (_mergedPolygon.size() > 0) {
 		if (_pathFinder.isDirty()) {
-			_mergedPolygon = merge(_walkboxes);
-			_pathFinder.setWalkboxes(_mergedPolygon);
+			// walkboxes are often toggled back and forth, keep what has been merged for each state
+			const Common::String key = visibilityKey(_walkboxes);
+			if (!_mergedPolygons.tryGetVal(key, _mergedPolygon)) {
+				_mergedPolygon = merge(_walkboxes);
+				_mergedPolygons[key] = _mergedPolygon;
+			}
+			_pathFinder.setWalkboxes(_mergedPolygon, key);
 			_pathFinder.setDirty(false);
 		}
 		return _pathFinder.calculatePath(frm, to);
@@ -138,6 +138,7 @@ public:
 	Common::Array<Common::SharedPtr<Layer> > _layers; // Parallax layers of a room
 	Common::Array<Walkbox> _walkboxes;                // Represents the areas where an actor can or cannot walk
 	Common::Array<Walkbox> _mergedPolygon;
+	Common::HashMap<Common::String, Common::Array<Walkbox> > _mergedPolygons; // Merged walkboxes by walkbox visibility
 	Common::Array<Scaling> _scalings;                    // Defines the scaling of the actor in the room
 	Scaling _scaling;                                    // Defines the scaling of the actor in the room
 	HSQOBJECT _table;                                    // Squirrel table representing this room
@@ -117,6 +117,7 @@ void sq_close(HSQUIRRELVM v)
     SQSharedState *ss = _ss(v);
     _thread(ss->_root_vm)->Finalize();
     sq_delete(ss, SQSharedState);
+    sq_vm_releasepools();
 }
 
 SQInteger sq_getversion()
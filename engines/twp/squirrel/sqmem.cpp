@@ -2,10 +2,80 @@
     see copyright notice in squirrel.h
 */
 #include "sqpcheader.h"
+#include "common/memorypool.h"
 #ifndef SQ_EXCLUDE_DEFAULT_MEMFUNCTIONS
-void *sq_vm_malloc(SQUnsignedInteger size){ return malloc(size); }
+// Tables, closures, outers, strings and table nodes are small and allocated and
+// freed all the time by running scripts, keep them in pools of fixed size chunks.
+// Squirrel always passes the size of a block when freeing it, so the size selects
+// the pool the block came from.
+#define SQ_POOL_GRANULARITY 16
+#define SQ_POOL_MAXSIZE 256
+#define SQ_NUM_POOLS (SQ_POOL_MAXSIZE / SQ_POOL_GRANULARITY)
 
-void *sq_vm_realloc(void *p, SQUnsignedInteger SQ_UNUSED_ARG(oldsize), SQUnsignedInteger size){ return realloc(p, size); }
+static Common::MemoryPool *g_pools[SQ_NUM_POOLS];
+static SQUnsignedInteger g_pooledChunks = 0;
 
-void sq_vm_free(void *p, SQUnsignedInteger SQ_UNUSED_ARG(size)){ free(p); }
+static inline SQInteger sq_poolindex(SQUnsignedInteger size)
+{
+    if (size == 0 || size > SQ_POOL_MAXSIZE)
+        return -1;
+    return (SQInteger)((size - 1) / SQ_POOL_GRANULARITY);
+}
+
+void *sq_vm_malloc(SQUnsignedInteger size)
+{
+    SQInteger idx = sq_poolindex(size);
+    if (idx < 0)
+        return malloc(size);
+    if (!g_pools[idx])
+        g_pools[idx] = new Common::MemoryPool((idx + 1) * SQ_POOL_GRANULARITY);
+    g_pooledChunks++;
+    return g_pools[idx]->allocChunk();
+}
+
+void *sq_vm_realloc(void *p, SQUnsignedInteger oldsize, SQUnsignedInteger size)
+{
+    SQInteger oldidx = p ? sq_poolindex(oldsize) : -1;
+    SQInteger newidx = sq_poolindex(size);
+    if (oldidx < 0 && newidx < 0)
+        return realloc(p, size);
+    if (p && oldidx == newidx)
+        return p;
+    void *np = sq_vm_malloc(size);
+    if (p) {
+        memcpy(np, p, oldsize < size ? oldsize : size);
+        sq_vm_free(p, oldsize);
+    }
+    return np;
+}
+
+void sq_vm_free(void *p, SQUnsignedInteger size)
+{
+    if (!p)
+        return;
+    SQInteger idx = sq_poolindex(size);
+    if (idx < 0) {
+        free(p);
+        return;
+    }
+    g_pools[idx]->freeChunk(p);
+    g_pooledChunks--;
+}
+
+void sq_vm_releasepools()
+{
+    // Pools can only go away once nothing allocated from them is alive anymore.
+    for (SQInteger i = 0; i < SQ_NUM_POOLS; i++) {
+        if (!g_pools[i])
+            continue;
+        if (g_pooledChunks == 0) {
+            delete g_pools[i];
+            g_pools[i] = NULL;
+        } else {
+            g_pools[i]->freeUnusedPages();
+        }
+    }
+}
+#else
+void sq_vm_releasepools() {}
 #endif
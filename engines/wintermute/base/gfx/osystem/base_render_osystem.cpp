@@ -73,6 +73,8 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_ticketIndex.clear();
+	_transformedSurfaces.clear();
 
 	delete _dirtyRect;
 
@@ -171,6 +173,7 @@ bool BaseRenderOSystem::flip() {
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
+				removeTicketFromIndex(it);
 				it = _renderQueue.erase(it);
 				delete ticket;
 			} else {
@@ -194,6 +197,8 @@ bool BaseRenderOSystem::flip() {
 	}
 	_lastFrameIter = _renderQueue.end();
 
+	pruneTransformedSurfaces();
+
 	g_system->updateScreen();
 
 	return STATUS_OK;
@@ -259,6 +264,9 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
+		if (owner) {
+			addTicketToIndex(--_renderQueue.end());
+		}
 		drawFromSurface(ticket);
 		return;
 	}
@@ -270,30 +278,28 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
+		RenderQueueIterator compareTicket = findQueuedTicket(compare);
+		if (compareTicket != _renderQueue.end()) {
+			if (_disableDirtyRects) {
+				drawFromSurface(*compareTicket);
+			} else {
+				drawFromQueuedTicket(compareTicket);
 			}
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
+		if (owner) {
+			addTicketToIndex(_lastFrameIter);
+		}
 	} else {
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
+		if (owner) {
+			addTicketToIndex(--_renderQueue.end());
+		}
 		drawFromSurface(ticket);
 	}
 }
@@ -311,6 +317,110 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 			invalidateTicket(*it);
 		}
 	}
+
+	// Tickets already holding a transformed copy keep it until they are
+	// deleted, but new tickets must not pick up the stale pixels.
+	for (TransformedSurfaceCache::iterator cit = _transformedSurfaces.begin(); cit != _transformedSurfaces.end(); ++cit) {
+		if (cit->_key._owner == surf) {
+			_transformedSurfaces.erase(cit);
+		}
+	}
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::findQueuedTicket(const RenderTicket &compare) {
+	// All tickets up to _lastFrameIter were drawn this frame, so any
+	// ticket that doesn't want drawing yet comes after it in the queue.
+	Common::HashMap<uint32, Common::Array<RenderQueueIterator> >::const_iterator bucket = _ticketIndex.find(compare.getHash());
+	if (bucket == _ticketIndex.end()) {
+		return _renderQueue.end();
+	}
+
+	for (uint i = 0; i < bucket->_value.size(); i++) {
+		RenderTicket *ticket = *bucket->_value[i];
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			return bucket->_value[i];
+		}
+	}
+	return _renderQueue.end();
+}
+
+void BaseRenderOSystem::addTicketToIndex(const RenderQueueIterator &ticket) {
+	_ticketIndex[(*ticket)->getHash()].push_back(ticket);
+}
+
+void BaseRenderOSystem::removeTicketFromIndex(const RenderQueueIterator &ticket) {
+	Common::HashMap<uint32, Common::Array<RenderQueueIterator> >::iterator bucket = _ticketIndex.find((*ticket)->getHash());
+	if (bucket == _ticketIndex.end()) {
+		return;
+	}
+
+	Common::Array<RenderQueueIterator> &tickets = bucket->_value;
+	for (uint i = 0; i < tickets.size(); i++) {
+		if (tickets[i] == ticket) {
+			tickets.remove_at(i);
+			break;
+		}
+	}
+	if (tickets.empty()) {
+		_ticketIndex.erase(bucket);
+	}
+}
+
+Common::SharedPtr<Graphics::Surface> BaseRenderOSystem::getTransformedSurface(BaseSurfaceOSystem *owner, const Graphics::Surface &src,
+		const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform) {
+	TransformedSurfaceKey key;
+	key._owner = owner;
+	key._srcRect = srcRect;
+	key._filtering = _gameRef->getBilinearFiltering();
+	if (transform._angle != Graphics::kDefaultAngle) {
+		// The output size follows from the transform
+		key._width = key._height = 0;
+		key._angle = transform._angle;
+		key._zoom = transform._zoom;
+		key._hotspot = transform._hotspot;
+	} else {
+		key._width = dstRect.width();
+		key._height = dstRect.height();
+		key._angle = Graphics::kDefaultAngle;
+		key._zoom = Common::Point(Graphics::kDefaultZoomX, Graphics::kDefaultZoomY);
+		key._hotspot = Common::Point(Graphics::kDefaultHotspotX, Graphics::kDefaultHotspotY);
+	}
+
+	TransformedSurfaceCache::iterator it = _transformedSurfaces.find(key);
+	if (it != _transformedSurfaces.end()) {
+		return it->_value;
+	}
+
+	Graphics::Surface *surface;
+	if (transform._angle != Graphics::kDefaultAngle) {
+		surface = src.rotoscale(transform, key._filtering);
+	} else {
+		surface = src.scale(dstRect.width(), dstRect.height(), key._filtering);
+	}
+
+	Common::SharedPtr<Graphics::Surface> result(surface, Graphics::SurfaceDeleter());
+	_transformedSurfaces[key] = result;
+	return result;
+}
+
+void BaseRenderOSystem::pruneTransformedSurfaces() {
+	for (TransformedSurfaceCache::iterator it = _transformedSurfaces.begin(); it != _transformedSurfaces.end(); ++it) {
+		if (it->_value.unique()) {
+			_transformedSurfaces.erase(it);
+		}
+	}
+}
+
+bool BaseRenderOSystem::isOpaqueTicket(const RenderTicket *ticket) const {
+	const Graphics::TransformStruct &transform = ticket->_transform;
+	return transform._alphaDisable &&
+		transform._angle == Graphics::kDefaultAngle &&
+		transform._blendMode == Graphics::BLEND_NORMAL &&
+		(transform._rgbaMod & MS_ARGB(255, 0, 0, 0)) == MS_ARGB(255, 0, 0, 0) &&
+		(!ticket->getSurface() ||
+		 (transform._numTimesX * transform._numTimesY == 1 &&
+		  ticket->getSurface()->w == ticket->_dstRect.width() &&
+		  ticket->getSurface()->h == ticket->_dstRect.height()));
 }
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
@@ -343,9 +453,11 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
+		removeTicketFromIndex(ticket);
 		_renderQueue.erase(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
+		addTicketToIndex(_lastFrameIter);
 	}
 }
 
@@ -368,6 +480,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_wantsDraw == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
+			removeTicketFromIndex(it);
 			it = _renderQueue.erase(it);
 			delete ticket;
 		} else {
@@ -384,22 +497,26 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
-	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
-	// the background color. Typical use-case: Fullscreen FMVs.
-	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
-			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+	// If an OPAQUE ticket covers the whole dirty rect, then everything drawn before it
+	// (including the background color) would be overwritten, so start drawing from the
+	// topmost such ticket. Typical use-cases: Fullscreen FMVs, and scene backgrounds
+	// when only sprites on top of them changed.
+	RenderQueueIterator firstVisible = _renderQueue.begin();
+	bool needsClear = true;
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		if (isOpaqueTicket(*it) && (*it)->_dstRect.contains(*_dirtyRect)) {
+			firstVisible = it;
+			needsClear = false;
 		}
-		// Otherwise Do NOT fill.
-	} else {
+	}
+	if (needsClear) {
 		// Apply the clear-color to the dirty rect.
 		_renderSurface->fillRect(*_dirtyRect, _clearColor);
 	}
+	for (it = _renderQueue.begin(); it != firstVisible; ++it) {
+		(*it)->_wantsDraw = false;
+	}
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
 		if (ticket->_dstRect.intersects(*_dirtyRect)) {
@@ -428,6 +545,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_isValid == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
+			removeTicketFromIndex(it);
 			it = _renderQueue.erase(it);
 			delete ticket;
 		} else {
@@ -532,6 +650,8 @@ void BaseRenderOSystem::endSaveLoad() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_ticketIndex.clear();
+	_transformedSurfaces.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
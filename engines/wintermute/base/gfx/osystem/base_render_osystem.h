@@ -32,6 +32,9 @@
 
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/ptr.h"
 
 #include "graphics/managed_surface.h"
 #include "graphics/transform_struct.h"
@@ -54,6 +57,9 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * Tickets from last frame are found through a hash of their draw arguments,
+ * rather than by walking the queue for every draw call.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accommodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -92,9 +98,14 @@ public:
 	/**
 	 * Re-insert an existing ticket into the queue, adding a dirty rect
 	 * out-of-order from last draw from the ticket.
-	 * @param ticket iterator pointing to the ticket to be added.
+	 * @param ticket iterator to the queued ticket to be added.
 	 */
 	void drawFromQueuedTicket(const RenderQueueIterator &ticket);
+	/**
+	 * Get a rotated/scaled copy of a sub-area of a surface, shared between
+	 * all tickets drawing it with the same transform.
+	 */
+	Common::SharedPtr<Graphics::Surface> getTransformedSurface(BaseSurfaceOSystem *owner, const Graphics::Surface &src, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform);
 
 	bool setViewport(int left, int top, int right, int bottom) override;
 	bool setViewport(Rect32 *rect) override { return BaseRenderer::setViewport(rect); }
@@ -127,8 +138,55 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Find a valid ticket from last frame that hasn't been drawn yet
+	 * this frame, and matches the specified one.
+	 */
+	RenderQueueIterator findQueuedTicket(const RenderTicket &compare);
+	void addTicketToIndex(const RenderQueueIterator &ticket);
+	void removeTicketFromIndex(const RenderQueueIterator &ticket);
+	/**
+	 * Drop cached transformed surfaces that no ticket refers to anymore.
+	 */
+	void pruneTransformedSurfaces();
+	/**
+	 * Check if a ticket overwrites every pixel of its destination rect.
+	 */
+	bool isOpaqueTicket(const RenderTicket *ticket) const;
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
+	// Owned tickets in _renderQueue, by RenderTicket::getHash()
+	Common::HashMap<uint32, Common::Array<RenderQueueIterator> > _ticketIndex;
+
+	struct TransformedSurfaceKey {
+		BaseSurfaceOSystem *_owner;
+		Common::Rect _srcRect;
+		int16 _width;
+		int16 _height;
+		int32 _angle;
+		Common::Point _zoom;
+		Common::Point _hotspot;
+		bool _filtering;
+
+		bool operator==(const TransformedSurfaceKey &k) const {
+			return _owner == k._owner && _srcRect == k._srcRect &&
+				_width == k._width && _height == k._height &&
+				_angle == k._angle && _zoom == k._zoom && _hotspot == k._hotspot &&
+				_filtering == k._filtering;
+		}
+	};
+	struct TransformedSurfaceKey_Hash {
+		uint operator()(const TransformedSurfaceKey &k) const {
+			uint hash = (uint)(uintptr)k._owner;
+			hash = hash * 31 + (uint16)k._srcRect.left + ((uint)(uint16)k._srcRect.top << 16);
+			hash = hash * 31 + (uint16)k._srcRect.right + ((uint)(uint16)k._srcRect.bottom << 16);
+			hash = hash * 31 + (uint16)k._width + ((uint)(uint16)k._height << 16);
+			hash = hash * 31 + (uint)k._angle;
+			return hash;
+		}
+	};
+	typedef Common::HashMap<TransformedSurfaceKey, Common::SharedPtr<Graphics::Surface>, TransformedSurfaceKey_Hash> TransformedSurfaceCache;
+	TransformedSurfaceCache _transformedSurfaces;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
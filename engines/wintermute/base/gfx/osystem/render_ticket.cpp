@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 
 #include "graphics/managed_surface.h"
@@ -44,6 +45,16 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _isValid(true),
 	        _wantsDraw(true),
 	        _transform(transform) {
+	// Only hash what operator== compares
+	_hash = (uint32)(uintptr)owner;
+	_hash = _hash * 31 + (uint16)_dstRect.left + ((uint32)(uint16)_dstRect.top << 16);
+	_hash = _hash * 31 + (uint16)_dstRect.right + ((uint32)(uint16)_dstRect.bottom << 16);
+	_hash = _hash * 31 + (uint16)_srcRect.left + ((uint32)(uint16)_srcRect.top << 16);
+	_hash = _hash * 31 + (uint16)_srcRect.right + ((uint32)(uint16)_srcRect.bottom << 16);
+	_hash = _hash * 31 + (uint32)_transform._angle;
+	_hash = _hash * 31 + (uint16)_transform._zoom.x + ((uint32)(uint16)_transform._zoom.y << 16);
+	_hash = _hash * 31 + _transform._rgbaMod;
+
 	if (surf) {
 		assert(surf->format.bytesPerPixel == 4);
 
@@ -58,26 +69,21 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// NB: Mirroring and rotation are probably done in the wrong order.
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			_surface = temp.rotoscale(transform, owner->_gameRef->getBilinearFiltering());
-		} else if ((dstRect->width() != srcRect->width() ||
-			    dstRect->height() != srcRect->height()) &&
-			    _transform._numTimesX * _transform._numTimesY == 1) {
-			_surface = temp.scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
+		if (_transform._angle != Graphics::kDefaultAngle ||
+			((dstRect->width() != srcRect->width() ||
+			  dstRect->height() != srcRect->height()) &&
+			 _transform._numTimesX * _transform._numTimesY == 1)) {
+			BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(owner->_gameRef->_renderer);
+			_surface = renderer->getTransformedSurface(owner, temp, *srcRect, *dstRect, transform);
 		} else {
-			_surface = new Graphics::Surface();
-			_surface->copyFrom(temp);
+			Graphics::Surface *copy = new Graphics::Surface();
+			copy->copyFrom(temp);
+			_surface = Common::SharedPtr<Graphics::Surface>(copy, Graphics::SurfaceDeleter());
 		}
-	} else {
-		_surface = nullptr;
 	}
 }
 
 RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-	}
 }
 
 bool RenderTicket::operator==(const RenderTicket &t) const {
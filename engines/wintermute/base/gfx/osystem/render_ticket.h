@@ -30,6 +30,7 @@
 
 #include "graphics/managed_surface.h"
 
+#include "common/ptr.h"
 #include "common/rect.h"
 
 namespace Wintermute {
@@ -47,13 +48,16 @@ class BaseSurfaceOSystem;
  * (Video-surfaces may even change their data). The promise that is made when a ticket
  * is created is that what the state was of the surface at THAT point, is what will end
  * up on screen at flip() time.
+ * Rotated and scaled copies are shared between tickets through the renderer's
+ * transformed surface cache, as the same sprite is often drawn with the same
+ * transform at a different position (e.g. a moving actor).
  */
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _hash(0) {}
 	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	const Graphics::Surface *getSurface() const { return _surface.get(); }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::ManagedSurface *_targetSurface) const;
 	// Dirty-rects:
@@ -69,9 +73,12 @@ public:
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+	/** Hash of the fields compared by operator==, used to find the ticket from last frame. */
+	uint32 getHash() const { return _hash; }
 private:
-	Graphics::Surface *_surface;
+	Common::SharedPtr<Graphics::Surface> _surface;
 	Common::Rect _srcRect;
+	uint32 _hash;
 };
 
 } // End of namespace Wintermute
@@ -371,6 +371,7 @@ bool DXSkinInfo::create(uint32 vertexCount, uint32 fvf, uint32 boneCount) {
 	if (!_bones) {
 		return false;
 	}
+	_vertexInfluencesDirty = true;
 	for (uint32 i = 0; i < boneCount; i++) {
 		_bones[i]._name = nullptr;
 		_bones[i]._numInfluences = 0;
@@ -385,62 +386,173 @@ void DXSkinInfo::destroy() {
 	_bones = nullptr;
 }
 
-bool DXSkinInfo::updateSkinnedMesh(const DXMatrix *boneTransforms, void *srcVertices, void *dstVertices) {
-	uint32 vertexSize = DXGetFVFVertexSize(_fvf);
-	uint32 normalOffset = sizeof(DXVector3);
-	uint32 i, j;
-
-	for (i = 0; i < _numVertices; i++) {
-		DXVector3 *position = (DXVector3 *)((byte *)dstVertices + vertexSize * i);
-		position->_x = 0.0f;
-		position->_y = 0.0f;
-		position->_z = 0.0f;
+void DXSkinInfo::buildVertexInfluences() {
+	_vertexBones.resize(_numVertices * kMaxVertexInfluences);
+	_vertexWeights.resize(_numVertices * kMaxVertexInfluences);
+	_extraInfluences.clear();
+
+	Common::Array<byte> counts;
+	counts.resize(_numVertices);
+	for (uint32 i = 0; i < _numVertices; i++)
+		counts[i] = 0;
+	for (uint32 i = 0; i < _numVertices * kMaxVertexInfluences; i++) {
+		_vertexBones[i] = 0;
+		_vertexWeights[i] = 0.0f;
+	}
+
+	// Bones are walked in order, so the weighted sums are accumulated
+	// in the same order as when skinning bone by bone
+	for (uint32 i = 0; i < _numBones; i++) {
+		for (uint32 j = 0; j < _bones[i]._numInfluences; j++) {
+			uint32 vertex = _bones[i]._vertices[j];
+			if (vertex >= _numVertices)
+				continue;
+
+			if (counts[vertex] < kMaxVertexInfluences) {
+				uint32 slot = vertex * kMaxVertexInfluences + counts[vertex]++;
+				_vertexBones[slot] = i;
+				_vertexWeights[slot] = _bones[i]._weights[j];
+			} else {
+				DXExtraInfluence extra;
+				extra._vertex = vertex;
+				extra._bone = i;
+				extra._weight = _bones[i]._weights[j];
+				_extraInfluences.push_back(extra);
+			}
+		}
 	}
 
-	for (i = 0; i < _numBones; i++) {
-		DXMatrix boneMatrix = boneTransforms[i];
+	_vertexInfluencesDirty = false;
+}
 
-		for (j = 0; j < _bones[i]._numInfluences; j++) {
-			DXVector3 position;
-			DXVector3 *positionSrc = (DXVector3 *)((byte *)srcVertices + vertexSize * _bones[i]._vertices[j]);
-			DXVector3 *positionDst = (DXVector3 *)((byte *)dstVertices + vertexSize * _bones[i]._vertices[j]);
-			float weight = _bones[i]._weights[j];
+static inline void skinAffine(float *out, const DXMatrix &m, float weight, float x, float y, float z) {
+	out[0] += weight * (m._m[0][0] * x + m._m[1][0] * y + m._m[2][0] * z + m._m[3][0]);
+	out[1] += weight * (m._m[0][1] * x + m._m[1][1] * y + m._m[2][1] * z + m._m[3][1]);
+	out[2] += weight * (m._m[0][2] * x + m._m[1][2] * y + m._m[2][2] * z + m._m[3][2]);
+}
 
-			DXVec3TransformCoord(&position, positionSrc, &boneMatrix);
+static inline void skinNormal(float *out, const DXMatrix &m, float weight, float x, float y, float z) {
+	out[0] += weight * (m._m[0][0] * x + m._m[1][0] * y + m._m[2][0] * z);
+	out[1] += weight * (m._m[0][1] * x + m._m[1][1] * y + m._m[2][1] * z);
+	out[2] += weight * (m._m[0][2] * x + m._m[1][2] * y + m._m[2][2] * z);
+}
 
-			positionDst->_x += weight * position._x;
-			positionDst->_y += weight * position._y;
-			positionDst->_z += weight * position._z;
+bool DXSkinInfo::updateSkinnedMesh(const DXMatrix *boneTransforms, void *srcVertices, void *dstVertices) {
+	uint32 vertexSize = DXGetFVFVertexSize(_fvf);
+	uint32 normalOffset = sizeof(DXVector3);
+	bool hasNormals = (_fvf & DXFVF_NORMAL) != 0;
+	uint32 i, k;
+
+	if (_numBones == 0) {
+		// Unused influence slots refer to bone 0, so there is nothing to blend
+		for (i = 0; i < _numVertices; i++) {
+			byte *vertex = (byte *)dstVertices + vertexSize * i;
+			memset(vertex, 0, sizeof(DXVector3));
+			if (hasNormals)
+				memset(vertex + normalOffset, 0, sizeof(DXVector3));
 		}
+		return true;
 	}
 
-	if (_fvf & DXFVF_NORMAL) {
-		for (i = 0; i < _numVertices; i++) {
-			DXVector3 *normal = (DXVector3 *)((byte *)dstVertices + vertexSize * i + normalOffset);
-			normal->_x = 0.0f;
-			normal->_y = 0.0f;
-			normal->_z = 0.0f;
+	if (_vertexInfluencesDirty)
+		buildVertexInfluences();
+
+	// Bone matrices are usually affine, which lets us skip the
+	// perspective divide of DXVec3TransformCoord
+	bool affine = true;
+	for (i = 0; i < _numBones; i++) {
+		const DXMatrix &m = boneTransforms[i];
+		if (m._m[0][3] != 0.0f || m._m[1][3] != 0.0f || m._m[2][3] != 0.0f || m._m[3][3] != 1.0f) {
+			affine = false;
+			break;
 		}
+	}
 
+	Common::Array<DXMatrix> normalMatrices;
+	if (hasNormals) {
+		normalMatrices.resize(_numBones);
 		for (i = 0; i < _numBones; i++) {
 			DXMatrix boneInverse = boneTransforms[i];
 			DXMatrixInverse(&boneInverse, NULL, &boneInverse);
-			DXMatrixTranspose(&boneInverse, &boneInverse);
+			DXMatrixTranspose(&normalMatrices[i], &boneInverse);
+		}
+	}
+
+	const uint32 *vertexBones = _vertexBones.data();
+	const float *vertexWeights = _vertexWeights.data();
+	const byte *src = (const byte *)srcVertices;
+	byte *dst = (byte *)dstVertices;
+
+	for (i = 0; i < _numVertices; i++) {
+		const DXVector3 *positionSrc = (const DXVector3 *)src;
+		float position[3] = { 0.0f, 0.0f, 0.0f };
+
+		if (affine) {
+			for (k = 0; k < kMaxVertexInfluences; k++) {
+				skinAffine(position, boneTransforms[vertexBones[k]], vertexWeights[k], positionSrc->_x, positionSrc->_y, positionSrc->_z);
+			}
+		} else {
+			for (k = 0; k < kMaxVertexInfluences; k++) {
+				if (vertexWeights[k] == 0.0f)
+					continue;
+				DXVector3 transformed;
+				DXVec3TransformCoord(&transformed, positionSrc, &boneTransforms[vertexBones[k]]);
+				position[0] += vertexWeights[k] * transformed._x;
+				position[1] += vertexWeights[k] * transformed._y;
+				position[2] += vertexWeights[k] * transformed._z;
+			}
+		}
 
-			for (j = 0; j < _bones[i]._numInfluences; j++) {
-				DXVector3 normal;
-				DXVector3 *normalSrc = (DXVector3 *)((byte *)srcVertices + vertexSize * _bones[i]._vertices[j] + normalOffset);
-				DXVector3 *normalDst = (DXVector3 *)((byte *)dstVertices + vertexSize * _bones[i]._vertices[j] + normalOffset);
-				float weight = _bones[i]._weights[j];
+		DXVector3 *positionDst = (DXVector3 *)dst;
+		positionDst->_x = position[0];
+		positionDst->_y = position[1];
+		positionDst->_z = position[2];
 
-				DXVec3TransformNormal(&normal, normalSrc, &boneInverse);
+		if (hasNormals) {
+			const DXVector3 *normalSrc = (const DXVector3 *)(src + normalOffset);
+			float normal[3] = { 0.0f, 0.0f, 0.0f };
 
-				normalDst->_x += weight * normal._x;
-				normalDst->_y += weight * normal._y;
-				normalDst->_z += weight * normal._z;
+			for (k = 0; k < kMaxVertexInfluences; k++) {
+				skinNormal(normal, normalMatrices[vertexBones[k]], vertexWeights[k], normalSrc->_x, normalSrc->_y, normalSrc->_z);
 			}
+
+			DXVector3 *normalDst = (DXVector3 *)(dst + normalOffset);
+			normalDst->_x = normal[0];
+			normalDst->_y = normal[1];
+			normalDst->_z = normal[2];
+		}
+
+		vertexBones += kMaxVertexInfluences;
+		vertexWeights += kMaxVertexInfluences;
+		src += vertexSize;
+		dst += vertexSize;
+	}
+
+	// Vertices with more than kMaxVertexInfluences bones
+	for (i = 0; i < _extraInfluences.size(); i++) {
+		const DXExtraInfluence &extra = _extraInfluences[i];
+		const DXVector3 *positionSrc = (const DXVector3 *)((const byte *)srcVertices + vertexSize * extra._vertex);
+		DXVector3 *positionDst = (DXVector3 *)((byte *)dstVertices + vertexSize * extra._vertex);
+		DXVector3 position;
+
+		DXVec3TransformCoord(&position, positionSrc, &boneTransforms[extra._bone]);
+		positionDst->_x += extra._weight * position._x;
+		positionDst->_y += extra._weight * position._y;
+		positionDst->_z += extra._weight * position._z;
+
+		if (hasNormals) {
+			const DXVector3 *normalSrc = (const DXVector3 *)((const byte *)positionSrc + normalOffset);
+			DXVector3 *normalDst = (DXVector3 *)((byte *)positionDst + normalOffset);
+			DXVector3 normal;
+
+			DXVec3TransformNormal(&normal, normalSrc, &normalMatrices[extra._bone]);
+			normalDst->_x += extra._weight * normal._x;
+			normalDst->_y += extra._weight * normal._y;
+			normalDst->_z += extra._weight * normal._z;
 		}
+	}
 
+	if (hasNormals) {
 		for (i = 0; i < _numVertices; i++) {
 			DXVector3 *normalDest = (DXVector3 *)((byte *)dstVertices + (i * vertexSize) + normalOffset);
 			if ((normalDest->_x != 0.0f) && (normalDest->_y != 0.0f) && (normalDest->_z != 0.0f)) {
@@ -494,6 +606,7 @@ bool DXSkinInfo::setBoneInfluence(uint32 boneIdx, uint32 numInfluences, const ui
 	delete[] bone->_weights;
 	bone->_vertices = newVertices;
 	bone->_weights = newWeights;
+	_vertexInfluencesDirty = true;
 
 	return true;
 }
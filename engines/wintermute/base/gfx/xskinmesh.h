@@ -37,6 +37,8 @@
 #include "engines/wintermute/base/gfx/xfile_loader.h"
 #include "engines/wintermute/base/gfx/xmath.h"
 
+#include "common/array.h"
+
 namespace Wintermute {
 
 #define DXFVF_XYZ             0x0002
@@ -110,6 +112,23 @@ class DXSkinInfo {
 	uint32 _numBones{};
 	DXBone *_bones{};
 
+	// Bone influences rearranged per vertex, so skinning can walk the
+	// vertex buffer once in order. The first kMaxVertexInfluences
+	// influences of each vertex are stored inline (unused slots have
+	// zero weight), any further ones go to _extraInfluences.
+	static const uint32 kMaxVertexInfluences = 4;
+	struct DXExtraInfluence {
+		uint32 _vertex;
+		uint32 _bone;
+		float _weight;
+	};
+	Common::Array<uint32> _vertexBones;
+	Common::Array<float> _vertexWeights;
+	Common::Array<DXExtraInfluence> _extraInfluences;
+	bool _vertexInfluencesDirty{true};
+
+	void buildVertexInfluences();
+
 public:
 	~DXSkinInfo() { destroy(); }
 	bool create(uint32 vertexCount, uint32 fvf, uint32 boneCount);
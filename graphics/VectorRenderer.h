@@ -296,6 +296,12 @@ public:
 	 */
 	virtual void setGradientColors(uint8 r1, uint8 g1, uint8 b1, uint8 r2, uint8 g2, uint8 b2) = 0;
 
+	/**
+	 * Returns the active painting colors in the surface pixel format. Draw steps
+	 * which don't specify some of the colors paint with the active ones.
+	 */
+	virtual void getColors(uint32 &fg, uint32 &bg, uint32 &bevel, uint32 &gradientStart, uint32 &gradientEnd) const = 0;
+
 	/**
 	 * Sets the active drawing surface. All drawing from this
 	 * point on will be done on that surface.
@@ -494,6 +500,12 @@ public:
 	 */
 	virtual void drawStep(const Common::Rect &area, const Common::Rect &clip, const DrawStep &step, uint32 extra = 0);
 
+	/**
+	 * Sets up the renderer state (colors, fill mode, clipping...) for the
+	 * specified draw step like drawStep() does, without drawing anything.
+	 */
+	void setStepState(const Common::Rect &area, const Common::Rect &clip, const DrawStep &step, uint32 extra = 0);
+
 	/**
 	 * Copies the part of the current frame to the system overlay.
 	 *
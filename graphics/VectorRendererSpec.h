@@ -81,6 +81,13 @@ public:
 	void setBgColor(uint8 r, uint8 g, uint8 b) override { _bgColor = _format.RGBToColor(r, g, b); }
 	void setBevelColor(uint8 r, uint8 g, uint8 b) override { _bevelColor = _format.RGBToColor(r, g, b); }
 	void setGradientColors(uint8 r1, uint8 g1, uint8 b1, uint8 r2, uint8 g2, uint8 b2) override;
+	void getColors(uint32 &fg, uint32 &bg, uint32 &bevel, uint32 &gradientStart, uint32 &gradientEnd) const override {
+		fg = _fgColor;
+		bg = _bgColor;
+		bevel = _bevelColor;
+		gradientStart = _gradientStart;
+		gradientEnd = _gradientEnd;
+	}
 	void setClippingRect(const Common::Rect &clippingArea) override { _clippingArea = clippingArea; }
 
 	void copyFrame(OSystem *sys, const Common::Rect &r) override;
@@ -31,8 +31,11 @@
 #include "graphics/surface.h"
 #include "graphics/managed_surface.h"
 
+#include "common/array.h"
 #include "common/ustr.h"
 #include "common/file.h"
+#include "common/system.h"
+#include "common/debug.h"
 #include "common/config-manager.h"
 #include "common/singleton.h"
 #include "common/stream.h"
@@ -89,6 +92,200 @@ inline int divRoundToNearest(int dividend, int divisor) {
 
 } // End of anonymous namespace
 
+/**
+ * Glyph bitmaps of all TTF fonts are packed into a shared set of CLUT8 pages
+ * instead of one surface per glyph. Pages are filled shelf by shelf and once
+ * the atlas is full the least recently used page is recycled. Fonts keep the
+ * metrics of their glyphs and rasterize a glyph again when its page was
+ * recycled.
+ */
+class TTFGlyphAtlas {
+public:
+	struct Slot {
+		Slot() : page(-1), generation(0), x(0), y(0) {}
+
+		int page;
+		uint32 generation;
+		int x, y;
+	};
+
+	TTFGlyphAtlas();
+	~TTFGlyphAtlas();
+
+	/**
+	 * Reserve room for a w x h bitmap, evicting the least recently used
+	 * page if needed. Returns a pointer to the top left pixel of the cleared
+	 * area.
+	 */
+	uint8 *allocate(int w, int h, Slot &slot, int &pitch);
+
+	/**
+	 * Return the bitmap of a slot, or nullptr when its page was recycled
+	 * since the slot was allocated.
+	 */
+	const uint8 *lookup(const Slot &slot, int &pitch);
+
+	void addRasterizeTime(uint32 msecs) { _rasterizeTime += msecs; }
+	void printStats() const;
+
+private:
+	enum {
+		kPageSize = 256,
+		kMaxPages = 32
+	};
+
+	struct Shelf {
+		int y, height, used;
+	};
+
+	struct Page {
+		Surface surface;
+		Common::Array<Shelf> shelves;
+		int nextY;
+		uint32 generation;
+		uint32 lastUse;
+		uint32 usedPixels;
+	};
+
+	bool place(Page &page, int w, int h, int &x, int &y);
+	void resetPage(Page &page);
+
+	Common::Array<Page> _pages;
+	uint32 _clock;
+
+	uint32 _glyphCount;
+	uint32 _evictions;
+	uint32 _rasterizeTime;
+};
+
+TTFGlyphAtlas::TTFGlyphAtlas() : _clock(0), _glyphCount(0), _evictions(0), _rasterizeTime(0) {
+}
+
+TTFGlyphAtlas::~TTFGlyphAtlas() {
+	printStats();
+
+	for (uint i = 0; i < _pages.size(); ++i)
+		_pages[i].surface.free();
+}
+
+bool TTFGlyphAtlas::place(Page &page, int w, int h, int &x, int &y) {
+	// Use the lowest shelf the glyph fits on, so small glyphs don't waste
+	// the height of shelves opened for large ones.
+	Shelf *best = nullptr;
+	for (uint i = 0; i < page.shelves.size(); ++i) {
+		Shelf &shelf = page.shelves[i];
+		if (shelf.height >= h && shelf.used + w <= page.surface.w && (!best || shelf.height < best->height))
+			best = &shelf;
+	}
+
+	// Open a new shelf rather than putting short glyphs on a much taller one
+	if ((!best || best->height > h * 2) && page.nextY + h <= page.surface.h && w <= page.surface.w) {
+		Shelf shelf;
+		shelf.y = page.nextY;
+		shelf.height = h;
+		shelf.used = 0;
+		page.nextY += h;
+		page.shelves.push_back(shelf);
+		best = &page.shelves.back();
+	}
+
+	if (!best)
+		return false;
+
+	x = best->used;
+	y = best->y;
+	best->used += w;
+	page.usedPixels += w * h;
+	return true;
+}
+
+void TTFGlyphAtlas::resetPage(Page &page) {
+	page.shelves.clear();
+	page.nextY = 0;
+	page.usedPixels = 0;
+	page.generation++;
+}
+
+uint8 *TTFGlyphAtlas::allocate(int w, int h, Slot &slot, int &pitch) {
+	int x = 0, y = 0;
+	int pageIdx = -1;
+
+	// Glyphs bigger than a page (huge fonts) get a page of their own size
+	if (w <= kPageSize && h <= kPageSize) {
+		for (uint i = 0; i < _pages.size(); ++i) {
+			if (place(_pages[i], w, h, x, y)) {
+				pageIdx = i;
+				break;
+			}
+		}
+	}
+
+	if (pageIdx < 0) {
+		if (_pages.size() < kMaxPages) {
+			_pages.push_back(Page());
+			pageIdx = _pages.size() - 1;
+			_pages[pageIdx].generation = 0;
+			resetPage(_pages[pageIdx]);
+		} else {
+			pageIdx = 0;
+			for (uint i = 1; i < _pages.size(); ++i) {
+				if (_pages[i].lastUse < _pages[pageIdx].lastUse)
+					pageIdx = i;
+			}
+			resetPage(_pages[pageIdx]);
+			_evictions++;
+			debug(5, "TTFGlyphAtlas: Recycling page %d", pageIdx);
+		}
+
+		Page &page = _pages[pageIdx];
+		const int pageW = MAX<int>(w, kPageSize);
+		const int pageH = MAX<int>(h, kPageSize);
+		if (page.surface.w != pageW || page.surface.h != pageH)
+			page.surface.create(pageW, pageH, PixelFormat::createFormatCLUT8());
+
+		place(page, w, h, x, y);
+	}
+
+	Page &page = _pages[pageIdx];
+	page.lastUse = ++_clock;
+	_glyphCount++;
+
+	slot.page = pageIdx;
+	slot.generation = page.generation;
+	slot.x = x;
+	slot.y = y;
+
+	pitch = page.surface.pitch;
+	uint8 *dst = (uint8 *)page.surface.getBasePtr(x, y);
+	for (int i = 0; i < h; ++i)
+		memset(dst + i * page.surface.pitch, 0, w);
+	return dst;
+}
+
+const uint8 *TTFGlyphAtlas::lookup(const Slot &slot, int &pitch) {
+	if (slot.page < 0 || slot.page >= (int)_pages.size())
+		return nullptr;
+
+	Page &page = _pages[slot.page];
+	if (page.generation != slot.generation)
+		return nullptr;
+
+	page.lastUse = ++_clock;
+	pitch = page.surface.pitch;
+	return (const uint8 *)page.surface.getBasePtr(slot.x, slot.y);
+}
+
+void TTFGlyphAtlas::printStats() const {
+	uint64 total = 0, used = 0;
+	for (uint i = 0; i < _pages.size(); ++i) {
+		total += _pages[i].surface.w * _pages[i].surface.h;
+		used += _pages[i].usedPixels;
+	}
+
+	debug(3, "TTFGlyphAtlas: %d pages, %d%% occupied, %d glyphs rasterized in %d ms, %d pages recycled",
+		(int)_pages.size(), total ? (int)(used * 100 / total) : 0, _glyphCount, _rasterizeTime, _evictions);
+}
+
 class TTFLibrary : public Common::Singleton<TTFLibrary> {
 public:
 	TTFLibrary();
@@ -101,8 +298,11 @@ public:
 
 	bool loadFont(Common::SeekableReadStream *ttfFile, FT_Stream stream, const int32 face_index, FT_Face &face);
 	void closeFont(FT_Face &face);
+
+	TTFGlyphAtlas &getAtlas() { return _atlas; }
 private:
 	FT_Library _library;
+	TTFGlyphAtlas _atlas;
 	bool _initialized;
 
 	static unsigned long readCallback(FT_Stream stream, unsigned long offset, unsigned char *buffer, unsigned long count);
@@ -194,18 +394,26 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
-		Surface image;
+		TTFGlyphAtlas::Slot image;
+		int width, height;
 		int xOffset, yOffset;
 		int advance;
 		FT_UInt slot;
 	};
 
 	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
+	bool rasterizeGlyph(Glyph &glyph) const;
+	const uint8 *getGlyphPixels(Glyph &glyph, int &pitch) const;
 	typedef Common::HashMap<uint32, Glyph> GlyphCache;
 	mutable GlyphCache _glyphs;
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
+	// Kerning of glyph pairs, keyed by both glyph indices. Every string
+	// measured or drawn asks for the kerning of each pair of characters.
+	typedef Common::HashMap<uint32, int> KerningCache;
+	mutable KerningCache _kerning;
+
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
 	int computePointSize(int size, TTFSizeMode sizeMode) const;
@@ -237,9 +445,6 @@ TTFFont::~TTFFont() {
 			delete _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
-
 		_initialized = false;
 	}
 }
@@ -583,9 +788,18 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!leftGlyph || !rightGlyph)
 		return 0;
 
+	// TrueType fonts have at most 65535 glyphs
+	const uint32 key = (leftGlyph << 16) | (rightGlyph & 0xFFFF);
+	KerningCache::const_iterator kerningEntry = _kerning.find(key);
+	if (kerningEntry != _kerning.end())
+		return kerningEntry->_value;
+
+	if (_kerning.size() >= 4096)
+		_kerning.clear();
+
 	FT_Vector kerningVector;
 	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	return _kerning[key] = (kerningVector.x / 64);
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
@@ -596,8 +810,7 @@ Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
 	} else {
 		const int xOffset = glyphEntry->_value.xOffset;
 		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
-		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
+		return Common::Rect(xOffset, yOffset, xOffset + glyphEntry->_value.width, yOffset + glyphEntry->_value.height);
 	}
 }
 
@@ -704,11 +917,11 @@ void TTFFont::drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint3
 void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 color,
 		const uint32 *transparentColor, bool alpha) const {
 	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
+	GlyphCache::iterator glyphEntry = _glyphs.find(chr);
 	if (glyphEntry == _glyphs.end())
 		return;
 
-	const Glyph &glyph = glyphEntry->_value;
+	Glyph &glyph = glyphEntry->_value;
 
 	x += glyph.xOffset;
 	y += glyph.yOffset;
@@ -718,10 +931,16 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 	if (y > dst->h)
 		return;
 
-	int w = glyph.image.w;
-	int h = glyph.image.h;
+	int w = glyph.width;
+	int h = glyph.height;
 
-	const uint8 *srcPos = (const uint8 *)glyph.image.getPixels();
+	if (w <= 0 || h <= 0)
+		return;
+
+	int srcPitch;
+	const uint8 *srcPos = getGlyphPixels(glyph, srcPitch);
+	if (!srcPos)
+		return;
 
 	// Make sure we are not drawing outside the screen bounds
 	if (x < 0) {
@@ -737,7 +956,7 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 		return;
 
 	if (y < 0) {
-		srcPos -= y * glyph.image.pitch;
+		srcPos -= y * srcPitch;
 		h += y;
 		y = 0;
 	}
@@ -752,11 +971,11 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 
 	if (alpha) {
 		if (dst->format.bytesPerPixel == 1) {
-			renderAlphaGlyph<uint8>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint8>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format);
 		} else if (dst->format.bytesPerPixel == 2) {
-			renderAlphaGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint16>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format);
 		} else if (dst->format.bytesPerPixel == 4) {
-			renderAlphaGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint32>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format);
 		}
 	} else {
 		if (dst->format.isCLUT8()) {
@@ -775,14 +994,14 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 				}
 
 				dstPos += dst->pitch;
-				srcPos += glyph.image.pitch;
+				srcPos += srcPitch;
 			}
 		} else if (dst->format.bytesPerPixel == 1) {
-			renderGlyph<uint8>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint8>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format, transparentColor);
 		} else if (dst->format.bytesPerPixel == 2) {
-			renderGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint16>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format, transparentColor);
 		} else if (dst->format.bytesPerPixel == 4) {
-			renderGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint32>(dstPos, dst->pitch, srcPos, srcPitch, w, h, color, dst->format, transparentColor);
 		}
 	}
 }
@@ -794,6 +1013,27 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 
 	glyph.slot = slot;
 
+	return rasterizeGlyph(glyph);
+}
+
+const uint8 *TTFFont::getGlyphPixels(Glyph &glyph, int &pitch) const {
+	TTFGlyphAtlas &atlas = g_ttf.getAtlas();
+
+	const uint8 *pixels = atlas.lookup(glyph.image, pitch);
+	if (pixels)
+		return pixels;
+
+	// The atlas page holding the glyph has been recycled, render it again
+	if (!rasterizeGlyph(glyph))
+		return nullptr;
+
+	return atlas.lookup(glyph.image, pitch);
+}
+
+bool TTFFont::rasterizeGlyph(Glyph &glyph) const {
+	const uint32 startTime = g_system->getMillis();
+	const FT_UInt slot = glyph.slot;
+
 	// We use the light target and render mode to improve the looks of the
 	// glyphs. It is most noticeable in FreeSansBold.ttf, where otherwise the
 	// 't' glyph looks like it is cut off on the right side.
@@ -852,7 +1092,9 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	}
 
 
-	glyph.image.create(bitmap->width, bitmap->rows, PixelFormat::createFormatCLUT8());
+	glyph.width = bitmap->width;
+	glyph.height = bitmap->rows;
+	glyph.image = TTFGlyphAtlas::Slot();
 
 	const uint8 *src = bitmap->buffer;
 	int srcPitch = bitmap->pitch;
@@ -861,41 +1103,43 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
-	uint8 *dst = (uint8 *)glyph.image.getPixels();
+	if (bitmap->pixel_mode != FT_PIXEL_MODE_MONO && bitmap->pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
+		return false;
+	}
 
-	switch (bitmap->pixel_mode) {
-	case FT_PIXEL_MODE_MONO:
-		for (int y = 0; y < (int)bitmap->rows; ++y) {
-			const uint8 *curSrc = src;
-			uint8 mask = 0;
+	// Empty glyphs like spaces only need their metrics
+	if (glyph.width > 0 && glyph.height > 0) {
+		int dstPitch;
+		uint8 *dst = g_ttf.getAtlas().allocate(glyph.width, glyph.height, glyph.image, dstPitch);
 
-			for (int x = 0; x < (int)bitmap->width; ++x) {
-				if ((x % 8) == 0)
-					mask = *curSrc++;
+		if (bitmap->pixel_mode == FT_PIXEL_MODE_MONO) {
+			for (int y = 0; y < (int)bitmap->rows; ++y) {
+				const uint8 *curSrc = src;
+				uint8 *curDst = dst;
+				uint8 mask = 0;
 
-				if (mask & 0x80)
-					*dst = 255;
+				for (int x = 0; x < (int)bitmap->width; ++x) {
+					if ((x % 8) == 0)
+						mask = *curSrc++;
 
-				mask <<= 1;
-				++dst;
-			}
+					if (mask & 0x80)
+						*curDst = 255;
 
-			src += srcPitch;
-		}
-		break;
+					mask <<= 1;
+					++curDst;
+				}
 
-	case FT_PIXEL_MODE_GRAY:
-		for (int y = 0; y < (int)bitmap->rows; ++y) {
-			memcpy(dst, src, bitmap->width);
-			dst += glyph.image.pitch;
-			src += srcPitch;
+				dst += dstPitch;
+				src += srcPitch;
+			}
+		} else {
+			for (int y = 0; y < (int)bitmap->rows; ++y) {
+				memcpy(dst, src, bitmap->width);
+				dst += dstPitch;
+				src += srcPitch;
+			}
 		}
-		break;
-
-	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
-		glyph.image.free();
-		return false;
 	}
 
 #if FAKE_BOLD == 1
@@ -904,6 +1148,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	}
 #endif
 
+	g_ttf.getAtlas().addRasterizeTime(g_system->getMillis() - startTime);
 	return true;
 }
 
@@ -58,6 +58,8 @@ void MacTextCanvas::chopChunk(const Common::U32String &str, int *curLinePtr, int
 	curChunk = _text[curLine].chunks.size() - 1;
 	chunk = &_text[curLine].chunks[curChunk];
 
+	_text[curLine].layoutDirty = true;
+
 	// Check if there is nothing to add, then remove the last chunk
 	// This happens when the previous run is finished only with
 	// empty formatting, or when we were adding text for the first time
@@ -246,6 +248,9 @@ const Common::U32String::value_type *MacTextCanvas::splitString(const Common::U3
 	if (curLine == -1 || curLine >= (int)_text.size())
 		curLine = _text.size() - 1;
 
+	// Text gets appended to this line, all others are new
+	_text[curLine].layoutDirty = true;
+
 	if (_text[curLine].chunks.empty())
 		_text[curLine].chunks.push_back(_defaultFormatting);
 
@@ -976,6 +981,11 @@ int MacTextCanvas::getLineHeight(int line) {
 	return _text[line].height;
 }
 
+void MacTextCanvas::invalidateLayout() {
+	for (uint i = 0; i < _text.size(); i++)
+		_text[i].layoutDirty = true;
+}
+
 void MacTextCanvas::recalcDims() {
 	if (_text.empty())
 		return;
@@ -983,16 +993,37 @@ void MacTextCanvas::recalcDims() {
 	int y = 0;
 	_textMaxWidth = 0;
 
+	uint relayout = 0;
+
 	for (uint i = 0; i < _text.size(); i++) {
-		_text[i].y = y;
+		MacTextLine &line = _text[i];
+
+		line.y = y;
+
+		// Only measure lines which were changed since the last time. Pictures
+		// and tables depend on other state but are cheap to recompute anyway.
+		if (!line.layoutDirty && line.picfname.empty() && !line.table && line.width != -1 && line.height != -1) {
+			_textMaxWidth = MAX(_textMaxWidth, line.width);
+		} else {
+			// We must calculate width first, because it enforces
+			// the computation. Calling Height() will return cached value!
+			_textMaxWidth = MAX(_textMaxWidth, getLineWidth(i, true));
+			line.layoutDirty = false;
+
+			relayout++;
+		}
 
-		// We must calculate width first, because it enforces
-		// the computation. Calling Height() will return cached value!
-		_textMaxWidth = MAX(_textMaxWidth, getLineWidth(i, true));
 		y += MAX(getLineHeight(i), _interLinear);
 	}
 
 	_textMaxHeight = y;
+
+	_relayoutLines += relayout;
+	_reusedLayoutLines += _text.size() - relayout;
+
+	if (relayout)
+		debug(9, "MacTextCanvas::recalcDims: measured %d of %d lines (total %d measured, %d reused)",
+			relayout, (int)_text.size(), _relayoutLines, _reusedLayoutLines);
 }
 
 int MacTextCanvas::getAlignOffset(int row) {
@@ -125,10 +125,16 @@ public:
 	MacFontRun _defaultFormatting;
 	ImageArchive _imageArchive;
 
+	// Number of lines measured and reused by recalcDims(), for profiling
+	uint32 _relayoutLines = 0;
+	uint32 _reusedLayoutLines = 0;
+
 public:
 	~MacTextCanvas();
 
 	void recalcDims();
+	// Makes the next recalcDims() measure all lines again
+	void invalidateLayout();
 	void reallocSurface();
 	void render(int from, int to);
 	void render(int from, int to, int shadow);
@@ -180,6 +186,7 @@ struct MacTextLine {
 	int minWidth = -1;
 	int y = 0;
 	int charwidth = -1;
+	bool layoutDirty = true; // changed since recalcDims() last measured it
 	bool paragraphEnd = false;
 	bool wordContinuation = false;
 	int indent = 0; // in units
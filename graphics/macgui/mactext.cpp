@@ -423,6 +423,7 @@ void MacText::enforceTextFont(uint16 fontId) {
 		}
 	}
 
+	_canvas.invalidateLayout();
 	_fullRefresh = true;
 	render();
 	_contentIsDirty = true;
@@ -435,6 +436,7 @@ void MacText::setTextSize(int textSize) {
 		}
 	}
 
+	_canvas.invalidateLayout();
 	_fullRefresh = true;
 	render();
 	_contentIsDirty = true;
@@ -540,6 +542,7 @@ void MacText::setTextChunks(int start, int end, int param, void (*callback)(MacF
 		for (uint j = from; j < to; j++) {
 			callback(_canvas._text[i].chunks[j], param);
 		}
+		_canvas._text[i].layoutDirty = true;
 	}
 
 	_fullRefresh = true;
@@ -570,6 +573,7 @@ void MacText::enforceTextSlant(int textSlant) {
 		}
 	}
 
+	_canvas.invalidateLayout();
 	_fullRefresh = true;
 	render();
 	_contentIsDirty = true;
@@ -859,8 +863,10 @@ void MacText::clearChunkInput() {
 	if (canvasTextSize >= 0 && _editable) {
 		int lastChunkIdx = _canvas._text[canvasTextSize].chunks.size() - 1;
 
-		if (lastChunkIdx >= 0)
+		if (lastChunkIdx >= 0) {
 			_canvas._text[canvasTextSize].chunks[lastChunkIdx].text = "";
+			_canvas._text[canvasTextSize].layoutDirty = true;
+		}
 	}
 }
 
@@ -1941,6 +1947,7 @@ void MacText::insertChar(byte c, int *row, int *col) {
 
 	line->chunks[ch].text = newchunk;
 	line->width = -1;	// Force recalc
+	line->layoutDirty = true;
 
 	(*col)++;
 
@@ -2037,6 +2044,7 @@ void MacText::deletePreviousCharInternal(int *row, int *col) {
 	}
 
 	_canvas._text[*row].width = -1; // flush the cache
+	_canvas._text[*row].layoutDirty = true;
 }
 
 void MacText::deletePreviousChar(int *row, int *col) {
@@ -2097,6 +2105,7 @@ void MacText::addNewLine(int *row, int *col) {
 		line->chunks.pop_back();
 	}
 	line->width = -1; // Drop cache
+	line->layoutDirty = true;
 
 	_canvas._text[*row].width = -1; // flush the cache
 
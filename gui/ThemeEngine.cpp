@@ -96,6 +96,59 @@ struct WidgetDrawData {
 	void calcBackgroundOffset();
 };
 
+/** Different drawings remembered to give the same pixels, see ThemeEngine::addCachedDD() */
+static const uint kDrawDataCacheStamps = 4;
+
+struct DrawDataCacheEntry {
+	Common::Rect _region;
+
+	/** Paint stamps of the drawings giving these pixels, see ThemeEngine::drawDD() */
+	uint64 _stamps[kDrawDataCacheStamps];
+	uint _numStamps;
+
+	/** Paint stamp of the pixels */
+	uint64 _result;
+
+	/** Pixels of the region after drawing */
+	Graphics::Surface _pixels;
+
+	/** Value of the cache clock when last used, for evicting */
+	uint32 _lastUse;
+
+	~DrawDataCacheEntry() {
+		_pixels.free();
+	}
+};
+
+/** Memory used by the DrawData cache, in screen sizes */
+static const uint32 kDrawDataCacheScreens = 3;
+
+/** Paint records kept per surface before they get merged into one stamp */
+static const uint kMaxPaintRecords = 256;
+
+enum PaintStampType {
+	kPaintStampUnknown = 1,
+	kPaintStampPixels,
+	kPaintStampDrawData,
+	kPaintStampText,
+	kPaintStampRestore,
+	kPaintStampShading
+};
+
+static inline uint64 mixStamp(uint64 stamp, uint64 value) {
+	// FNV-1a over 64-bit words
+	return (stamp ^ value) * 1099511628211ULL;
+}
+
+static inline uint64 mixStamp(uint64 stamp, const Common::Rect &r) {
+	return mixStamp(stamp, (uint64)(uint16)r.left | ((uint64)(uint16)r.top << 16) |
+		((uint64)(uint16)r.right << 32) | ((uint64)(uint16)r.bottom << 48));
+}
+
+static inline uint64 newStamp(PaintStampType type) {
+	return mixStamp(14695981039346656037ULL, type);
+}
+
 /**********************************************************
  *  Data definitions for theme engine elements
  *********************************************************/
@@ -188,6 +241,7 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(nullptr), _vectorRenderer(nullptr),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
+	_drawDataCacheSize(0), _drawDataCacheClock(0), _paintCounter(0), _statCachedDD(0), _statRenderedDD(0),
 	_font(nullptr), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(nullptr), _scaleFactor(1.0f) {
 
@@ -233,11 +287,15 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_cursorFormat = Graphics::PixelFormat::createFormatCLUT8();
 	_cursorPalSize = 0;
 
+	resetPaintLogs();
+
 	// We prefer files in archive bundles over the common search paths.
 	_themeFiles.add("default", &SearchMan, 0, false);
 }
 
 ThemeEngine::~ThemeEngine() {
+	clearDrawDataCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = nullptr;
 	_screen.free();
@@ -375,6 +433,25 @@ void ThemeEngine::clearAll() {
 	if (_initOk) {
 		_system->clearOverlay();
 		_system->grabOverlay(*_backBuffer.surfacePtr());
+
+		// The overlay shows whatever was below the GUI, checksum it once so that
+		// cached DrawData results are still usable for an unchanged overlay
+		uint64 stamp = newStamp(kPaintStampPixels);
+		const int rowSize = _backBuffer.w * _backBuffer.format.bytesPerPixel;
+		for (int y = 0; y < _backBuffer.h; y++) {
+			const byte *row = (const byte *)_backBuffer.getBasePtr(0, y);
+			int x = 0;
+			for (; x + 8 <= rowSize; x += 8) {
+				uint64 word;
+				memcpy(&word, row + x, sizeof(word));
+				stamp = mixStamp(stamp, word);
+			}
+			for (; x < rowSize; x++)
+				stamp = mixStamp(stamp, row[x]);
+		}
+
+		_backBufferLog._base = stamp;
+		_backBufferLog._records.clear();
 	}
 }
 
@@ -460,6 +537,8 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_screen.free();
 	_screen.create(width, height, _overlayFormat);
 
+	clearDrawDataCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
@@ -495,6 +574,7 @@ void ThemeEngine::restoreBackground(Common::Rect r) {
 	r.clip(_screen.w, _screen.h);
 	_vectorRenderer->blitSurface(&_backBuffer, r);
 
+	addPaintRecord(_screenLog, r, mixStamp(newStamp(kPaintStampRestore), getPaintStamp(_backBufferLog, r)));
 	addDirtyRect(r);
 }
 
@@ -786,6 +866,8 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 }
 
 void ThemeEngine::unloadTheme() {
+	clearDrawDataCache();
+
 	if (!_themeOk)
 		return;
 
@@ -948,15 +1030,215 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
-			_vectorRenderer->drawStep(area, _clip, *step, dynamic);
+		// Shadows reach a bit further than extendedRect, the cached
+		// region must hold every pixel the draw steps may touch
+		Common::Rect region = area;
+		region.grow(kDirtyRectangleThreshold + drawData->_backgroundOffset + drawData->_shadowOffset + 2);
+		region.clip(_screen.w, _screen.h);
+
+		// The result depends on the draw steps, the renderer colors used by
+		// the steps which don't set their own, and what it is drawn over.
+		// Colors set by the first step can't leak into the result.
+		uint32 colors[5];
+		_vectorRenderer->getColors(colors[0], colors[1], colors[2], colors[3], colors[4]);
+		if (!drawData->_steps.empty()) {
+			const Graphics::DrawStep &first = drawData->_steps.front();
+			if (first.fgColor.set)
+				colors[0] = 0;
+			if (first.bgColor.set)
+				colors[1] = 0;
+			if (first.bevelColor.set)
+				colors[2] = 0;
+			if (first.gradColor1.set && first.gradColor2.set)
+				colors[3] = colors[4] = 0;
+		}
+
+		PaintLog &log = activePaintLog();
+		uint64 stamp = mixStamp(newStamp(kPaintStampDrawData), getPaintStamp(log, region));
+		stamp = mixStamp(stamp, type);
+		stamp = mixStamp(stamp, dynamic);
+		stamp = mixStamp(stamp, area);
+		stamp = mixStamp(stamp, region);
+		stamp = mixStamp(stamp, _clip);
+		for (uint i = 0; i < ARRAYSIZE(colors); i++)
+			stamp = mixStamp(stamp, colors[i]);
+
+		if (!drawCachedDD(type, area, dynamic, stamp)) {
+			Common::List<Graphics::DrawStep>::const_iterator step;
+			for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+				_vectorRenderer->drawStep(area, _clip, *step, dynamic);
+			}
+
+			if (!region.isEmpty())
+				addCachedDD(type, area, region, stamp);
+
+			_statRenderedDD++;
 		}
 
+		addPaintRecord(log, region, stamp);
 		addDirtyRect(extendedRect);
 	}
 }
 
+bool ThemeEngine::drawCachedDD(DrawData type, const Common::Rect &area, uint32 dynamic, uint64 &stamp) {
+	DrawDataCacheKey key;
+	key._type = type;
+	key._area = area;
+
+	DrawDataCache::iterator it = _drawDataCache.find(key);
+	if (it == _drawDataCache.end())
+		return false;
+
+	DrawDataCacheEntry *entry = it->_value;
+
+	uint i;
+	for (i = 0; i < MIN(entry->_numStamps, kDrawDataCacheStamps); i++) {
+		if (entry->_stamps[i] == stamp)
+			break;
+	}
+
+	if (i == MIN(entry->_numStamps, kDrawDataCacheStamps))
+		return false;
+
+	const Common::Rect &region = entry->_region;
+
+	Graphics::Surface *dst = _vectorRenderer->getActiveSurface()->surfacePtr();
+	dst->copyRectToSurface(entry->_pixels, region.left, region.top, Common::Rect(region.width(), region.height()));
+
+	// Leave the renderer in the state the draw steps would have left it
+	const WidgetDrawData *drawData = _widgets[type];
+	Common::List<Graphics::DrawStep>::const_iterator step;
+	for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+		_vectorRenderer->setStepState(area, _clip, *step, dynamic);
+	}
+
+	stamp = entry->_result;
+	entry->_lastUse = ++_drawDataCacheClock;
+
+	_statCachedDD++;
+	return true;
+}
+
+void ThemeEngine::addCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &region, uint64 &stamp) {
+	DrawDataCacheKey key;
+	key._type = type;
+	key._area = area;
+
+	const Graphics::Surface *src = _vectorRenderer->getActiveSurface()->surfacePtr();
+
+	// Only keep the latest result for each element
+	DrawDataCacheEntry *&entry = _drawDataCache[key];
+	if (!entry) {
+		entry = new DrawDataCacheEntry;
+	} else {
+		// Drawing over another background may still give the same pixels, as
+		// it does when an element gets redrawn over itself. Checking that once
+		// lets the next redraw come from the cache, and keeps the paint stamp
+		// of the region from changing on every redraw.
+		bool samePixels = (entry->_region == region);
+		const int rowSize = region.width() * src->format.bytesPerPixel;
+		for (int y = 0; y < region.height() && samePixels; y++) {
+			samePixels = !memcmp(entry->_pixels.getBasePtr(0, y), src->getBasePtr(region.left, region.top + y), rowSize);
+		}
+
+		if (samePixels) {
+			entry->_stamps[entry->_numStamps++ % kDrawDataCacheStamps] = stamp;
+			entry->_lastUse = ++_drawDataCacheClock;
+			stamp = entry->_result;
+			return;
+		}
+
+		_drawDataCacheSize -= entry->_pixels.pitch * entry->_pixels.h;
+		entry->_pixels.free();
+	}
+
+	entry->_region = region;
+	entry->_stamps[0] = stamp;
+	entry->_numStamps = 1;
+	entry->_result = stamp;
+	entry->_lastUse = ++_drawDataCacheClock;
+	entry->_pixels.create(region.width(), region.height(), _screen.format);
+	entry->_pixels.copyRectToSurface(*src, 0, 0, region);
+	_drawDataCacheSize += entry->_pixels.pitch * entry->_pixels.h;
+
+	// A region never exceeds the screen, so full dialog backgrounds always fit
+	const uint32 maxSize = kDrawDataCacheScreens * _screen.pitch * _screen.h;
+	while (_drawDataCacheSize > maxSize) {
+		DrawDataCache::iterator it, oldest = _drawDataCache.end();
+		for (it = _drawDataCache.begin(); it != _drawDataCache.end(); ++it) {
+			if (oldest == _drawDataCache.end() || it->_value->_lastUse < oldest->_value->_lastUse)
+				oldest = it;
+		}
+
+		_drawDataCacheSize -= oldest->_value->_pixels.pitch * oldest->_value->_pixels.h;
+		delete oldest->_value;
+		_drawDataCache.erase(oldest);
+	}
+}
+
+void ThemeEngine::clearDrawDataCache() {
+	DrawDataCache::iterator it;
+	for (it = _drawDataCache.begin(); it != _drawDataCache.end(); ++it)
+		delete it->_value;
+
+	_drawDataCache.clear();
+	_drawDataCacheSize = 0;
+
+	// Stamps depend on fonts and colors of the theme, don't let them outlive it
+	resetPaintLogs();
+}
+
+ThemeEngine::PaintLog &ThemeEngine::activePaintLog() {
+	return _vectorRenderer->getActiveSurface() == &_backBuffer ? _backBufferLog : _screenLog;
+}
+
+uint64 ThemeEngine::getPaintStamp(const PaintLog &log, const Common::Rect &r) const {
+	uint64 stamp = log._base;
+
+	for (uint i = 0; i < log._records.size(); i++) {
+		if (log._records[i]._rect.intersects(r)) {
+			stamp = mixStamp(stamp, log._records[i]._rect);
+			stamp = mixStamp(stamp, log._records[i]._stamp);
+		}
+	}
+
+	return stamp;
+}
+
+void ThemeEngine::addPaintRecord(PaintLog &log, const Common::Rect &r, uint64 stamp) {
+	if (r.isEmpty())
+		return;
+
+	// Records covered by the new one don't matter anymore, its stamp includes them
+	uint count = 0;
+	for (uint i = 0; i < log._records.size(); i++) {
+		if (!r.contains(log._records[i]._rect))
+			log._records[count++] = log._records[i];
+	}
+	log._records.resize(count);
+
+	PaintRecord record;
+	record._rect = r;
+	record._stamp = stamp;
+	log._records.push_back(record);
+
+	if (log._records.size() > kMaxPaintRecords) {
+		log._base = getPaintStamp(log, Common::Rect(_screen.w, _screen.h));
+		log._records.clear();
+	}
+}
+
+uint64 ThemeEngine::newPaintStamp() {
+	return mixStamp(newStamp(kPaintStampUnknown), ++_paintCounter);
+}
+
+void ThemeEngine::resetPaintLogs() {
+	_screenLog._base = newPaintStamp();
+	_screenLog._records.clear();
+	_backBufferLog._base = newPaintStamp();
+	_backBufferLog._records.clear();
+}
+
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::U32String &text,
 	bool restoreBg, bool ellipsis, Graphics::TextAlign alignH, TextAlignVertical alignV,
 	int deltax, const Common::Rect &drawableTextArea) {
@@ -988,6 +1270,17 @@ void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect
 	_vectorRenderer->drawString(_texts[type]->_fontPtr, text, area, alignH, alignV, deltax, ellipsis, dirty);
 #endif
 
+	PaintLog &log = activePaintLog();
+	uint64 stamp = mixStamp(newStamp(kPaintStampText), getPaintStamp(log, dirty));
+	stamp = mixStamp(stamp, (uintptr)_texts[type]->_fontPtr);
+	stamp = mixStamp(stamp, _vectorRenderer->getActiveSurface()->format.RGBToColor(_textColors[color]->r, _textColors[color]->g, _textColors[color]->b));
+	stamp = mixStamp(stamp, area);
+	stamp = mixStamp(stamp, dirty);
+	stamp = mixStamp(stamp, alignH | (alignV << 8) | ((uint64)ellipsis << 16) | ((uint64)(uint32)deltax << 32));
+	for (uint i = 0; i < text.size(); i++)
+		stamp = mixStamp(stamp, text[i]);
+	addPaintRecord(log, dirty, stamp);
+
 	addDirtyRect(dirty);
 }
 
@@ -1254,6 +1547,7 @@ void ThemeEngine::drawManagedSurface(const Common::Point &p, const Graphics::Man
 
 	Common::Rect dirtyRect = Common::Rect(p.x, p.y, p.x + surface.w, p.y + surface.h);
 	dirtyRect.clip(_clip);
+	addPaintRecord(activePaintLog(), dirtyRect, newPaintStamp());
 	addDirtyRect(dirtyRect);
 }
 
@@ -1488,6 +1782,7 @@ void ThemeEngine::drawChar(const Common::Rect &r, byte ch, const Graphics::Font
 		break;
 	}
 	font->drawChar(&_screen, ch, charArea.left, charArea.top, rgbColor);
+	addPaintRecord(_screenLog, charArea, newPaintStamp());
 	addDirtyRect(charArea);
 }
 
@@ -1504,10 +1799,14 @@ void ThemeEngine::drawFoldIndicator(const Common::Rect &r, bool expanded) {
 	_vectorRenderer->setFillMode(Graphics::VectorRenderer::kFillForeground);
 	_vectorRenderer->setFgColor(_textColors[kTextColorNormal]->r, _textColors[kTextColorNormal]->g, _textColors[kTextColorNormal]->b);
 	_vectorRenderer->drawTriangle(r.left + r.width() / 4, r.top + r.height() / 4, r.width() / 2, r.height() / 2, orient);
+	addPaintRecord(activePaintLog(), r, newPaintStamp());
 	addDirtyRect(r);
 }
 
 void ThemeEngine::debugWidgetPosition(const char *name, const Common::Rect &r) {
+	_screenLog._base = newPaintStamp();
+	_screenLog._records.clear();
+
 	_font->drawString(&_screen, name, r.left, r.top, r.width(), 0xFFFF, Graphics::kTextAlignRight, 0, true);
 	_screen.hLine(r.left, r.top, r.right, 0xFFFF);
 	_screen.hLine(r.left, r.bottom, r.right, 0xFFFF);
@@ -1520,12 +1819,15 @@ void ThemeEngine::debugWidgetPosition(const char *name, const Common::Rect &r) {
  *********************************************************/
 void ThemeEngine::copyBackBufferToScreen() {
 	memcpy(_screen.getPixels(), _backBuffer.getPixels(), (size_t)(_screen.pitch * _screen.h));
+	_screenLog = _backBufferLog;
 }
 
 void ThemeEngine::updateScreen() {
 #ifdef LAYOUT_DEBUG_DIALOG
 	_vectorRenderer->fillSurface();
 	_themeEval->debugDraw(&_screen, _font);
+	_screenLog._base = newPaintStamp();
+	_screenLog._records.clear();
 	_vectorRenderer->copyWholeFrame(_system);
 #else
 	updateDirtyScreen();
@@ -1564,17 +1866,30 @@ void ThemeEngine::updateDirtyScreen() {
 	if (_dirtyScreen.empty())
 		return;
 
+	uint32 pixels = 0;
+
 	Common::List<Common::Rect>::iterator i;
 	for (i = _dirtyScreen.begin(); i != _dirtyScreen.end(); ++i) {
 		_vectorRenderer->copyFrame(_system, *i);
+		pixels += i->width() * i->height();
 	}
 
+	debug(9, "ThemeEngine: Updated %d rects (%d pixels), %d elements drawn from cache, %d rendered",
+		_dirtyScreen.size(), pixels, _statCachedDD, _statRenderedDD);
+
+	_statCachedDD = _statRenderedDD = 0;
+
 	_dirtyScreen.clear();
 }
 
 void ThemeEngine::applyScreenShading(ShadingStyle style) {
 	if (style != kShadingNone) {
 		_vectorRenderer->applyScreenShading(style);
+
+		PaintLog &log = activePaintLog();
+		log._base = mixStamp(mixStamp(newStamp(kPaintStampShading), getPaintStamp(log, Common::Rect(_screen.w, _screen.h))), style);
+		log._records.clear();
+
 		addDirtyRect(Common::Rect(0, 0, _screen.w, _screen.h));
 	}
 }
@@ -23,6 +23,7 @@
 #define GUI_THEME_ENGINE_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
 #include "common/hashmap.h"
@@ -48,6 +49,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct DrawDataCacheEntry;
 struct TextDrawData;
 class Dialog;
 class GuiObject;
@@ -458,7 +460,11 @@ public:
 	 */
 	void disableClipRect();
 
-	/** @name WIDGET DRAWING METHODS */
+	/**
+	 * @name WIDGET DRAWING METHODS
+	 * Anything writing to the screen or back buffer has to log the area
+	 * with addPaintRecord(), or cached DrawData gets copied over stale pixels.
+	 */
 	//@{
 
 	void drawWidgetBackground(const Common::Rect &r, WidgetBackground background);
@@ -713,6 +719,45 @@ protected:
 	 * These functions are called from all the Widget drawing methods.
 	 */
 	void drawDD(DrawData type, const Common::Rect &r, uint32 dynamic = 0, bool forceRestore = false);
+
+	/**
+	 * Pixels drawn by DrawData descriptors are cached, indexed by descriptor
+	 * and area. Drawing the same descriptor over the same background again,
+	 * as happens whenever a dialog gets redrawn, copies the cached result
+	 * instead of replaying the draw steps. The stamp identifies everything
+	 * the result depends on, including the paint stamp of its background,
+	 * and is replaced with the paint stamp of the pixels in the cache.
+	 */
+	bool drawCachedDD(DrawData type, const Common::Rect &area, uint32 dynamic, uint64 &stamp);
+	void addCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &region, uint64 &stamp);
+	void clearDrawDataCache();
+
+	/**
+	 * Surface contents are tracked with paint stamps rather than pixels.
+	 * Everything painted records the rectangle it touched, with a stamp
+	 * of its parameters and of the contents it was painted over, so equal
+	 * stamps for a rectangle mean equal pixels in it. Each paint entry point
+	 * (drawDD, drawDDText, restoreBackground, drawManagedSurface, drawChar,
+	 * drawFoldIndicator...) must call addPaintRecord(), or replace the base
+	 * stamp when it paints the whole surface, as applyScreenShading does.
+	 */
+	struct PaintRecord {
+		Common::Rect _rect;
+		uint64 _stamp;
+	};
+
+	struct PaintLog {
+		uint64 _base; ///< Stamp of the whole surface before the records
+		Common::Array<PaintRecord> _records;
+	};
+
+	PaintLog &activePaintLog();
+	uint64 getPaintStamp(const PaintLog &log, const Common::Rect &r) const;
+	void addPaintRecord(PaintLog &log, const Common::Rect &r, uint64 stamp);
+	/** Returns a stamp for contents which can't be described, which never matches another one */
+	uint64 newPaintStamp();
+	void resetPaintLogs();
+
 	void drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::U32String &text, bool restoreBg,
 	                bool elipsis, Graphics::TextAlign alignH = Graphics::kTextAlignLeft,
 	                TextAlignVertical alignV = kTextAlignVTop, int deltax = 0,
@@ -807,6 +852,32 @@ protected:
 	/** List of all the dirty screens that must be blitted to the overlay. */
 	Common::List<Common::Rect> _dirtyScreen;
 
+	struct DrawDataCacheKey {
+		DrawData _type;
+		Common::Rect _area;
+
+		bool operator==(const DrawDataCacheKey &key) const { return _type == key._type && _area == key._area; }
+	};
+
+	struct DrawDataCacheKey_Hash {
+		uint operator()(const DrawDataCacheKey &key) const {
+			return key._type + 31 * (key._area.left + 31 * (key._area.top + 31 * (key._area.right + 31 * key._area.bottom)));
+		}
+	};
+
+	typedef Common::HashMap<DrawDataCacheKey, DrawDataCacheEntry *, DrawDataCacheKey_Hash> DrawDataCache;
+
+	/** Recently drawn DrawData results. */
+	DrawDataCache _drawDataCache;
+	uint32 _drawDataCacheSize;
+	uint32 _drawDataCacheClock;
+
+	PaintLog _screenLog, _backBufferLog;
+	uint64 _paintCounter;
+
+	/** Redraw statistics since the last screen update. */
+	uint32 _statCachedDD, _statRenderedDD;
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
@@ -28,6 +28,7 @@
 
 #include "gui/gui-manager.h"
 #include "gui/widgets/grid.h"
+#include "gui/widgets/list.h"
 
 #include "gui/ThemeEval.h"
 
@@ -506,6 +507,7 @@ void GridWidget::setEntryList(Common::Array<GridItemInfo> *list) {
 	_dataEntryList.clear();
 	_headerEntryList.clear();
 	_sortedEntryList.clear();
+	_sortedEntryFilter.clear();
 	_visibleEntryList.clear();
 	_isGridInvalid = true;
 	_selectedEntry = nullptr;
@@ -554,7 +556,16 @@ void GridWidget::groupEntries() {
 
 void GridWidget::sortGroups() {
 	uint oldHeight = _innerHeight;
+
+	// While the filter is being typed it usually only gets longer, then only the
+	// entries still shown need to be checked again
+	Common::Array<GridItemInfo *> candidates;
+	bool narrowing = ListWidget::isFilterNarrowing(_sortedEntryFilter, _filter);
+	if (narrowing)
+		candidates.swap(_sortedEntryList);
+
 	_sortedEntryList.clear();
+	_sortedEntryFilter.clear();
 	_headerEntryList.clear();
 
 	if (_filter.empty()) {
@@ -590,27 +601,27 @@ void GridWidget::sortGroups() {
 		// as substrings, ignoring case.
 
 		Common::U32StringTokenizer tok(_filter);
-		Common::U32String tmp;
-		int n = 0;
+		Common::U32StringArray tokens;
+		while (!tok.empty())
+			tokens.push_back(tok.nextToken());
 
-		_sortedEntryList.clear();
-
-		for (GridItemInfo *i = _dataEntryList.begin(); i != _dataEntryList.end(); ++i, ++n) {
-			tmp = i->title;
-			tmp.toLowercase();
+		uint count = narrowing ? candidates.size() : _dataEntryList.size();
+		for (uint i = 0; i < count; ++i) {
+			GridItemInfo *entry = narrowing ? candidates[i] : &_dataEntryList[i];
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+			for (uint j = 0; j < tokens.size(); ++j) {
+				if (!entry->lowerTitle.contains(tokens[j])) {
 					matches = false;
 					break;
 				}
 			}
 
 			if (matches) {
-				_sortedEntryList.push_back(i);
+				_sortedEntryList.push_back(entry);
 			}
 		}
+
+		_sortedEntryFilter = _filter;
 	}
 
 	calcEntrySizes();
@@ -53,6 +53,7 @@ struct GridItemInfo {
 	Common::String 		engineid;
 	Common::String 		gameid;
 	Common::String 		title;
+	Common::U32String	lowerTitle;		///< title, lowercased once for the filter
 	Common::String		description;
 	Common::String		extra;
 	Common::String 		thumbPath;
@@ -66,6 +67,8 @@ struct GridItemInfo {
 	GridItemInfo(int id, const Common::String &eid, const Common::String &gid, const Common::String &t,
 		const Common::String &d, const Common::String &e, Common::Language l, Common::Platform p, bool v)
 		: entryID(id), gameid(gid), engineid(eid), title(t), description(d), extra(e), language(l), platform(p), validEntry(v), isHeader(false) {
+		lowerTitle = title;
+		lowerTitle.toLowercase();
 		thumbPath = Common::String::format("icons/%s-%s.png", engineid.c_str(), gameid.c_str());
 	}
 
@@ -168,6 +171,7 @@ public:
 	GridItemInfo	*_selectedEntry;
 
 	Common::U32String	_filter;
+	Common::U32String	_sortedEntryFilter;	///< Filter _sortedEntryList holds the matches of, if any
 
 	GridWidget(GuiObject *boss, const Common::String &name);
 	~GridWidget();
@@ -107,6 +107,7 @@ void GroupedListWidget::sortGroups() {
 	uint oldListSize = _list.size();
 	_list.clear();
 	_listIndex.clear();
+	_listIndexFilter.clear();
 
 	Common::sort(_groupHeaders.begin(), _groupHeaders.end(),
 		[](const Common::String &first, const Common::String &second) {
@@ -436,33 +437,8 @@ void GroupedListWidget::setFilter(const Common::U32String &filter, bool redraw)
 		// No filter -> display everything
 		sortGroups();
 	} else {
-		// Restrict the list to everything which contains all words in _filter
-		// as substrings, ignoring case.
-
-		Common::U32StringTokenizer tok(_filter);
-		Common::U32String tmp;
-		int n = 0;
-
-		_list.clear();
-		_listIndex.clear();
-
-		for (auto i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = i->clean;
-			tmp.toLowercase();
-			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!_filterMatcher(_filterMatcherArg, n, tmp, tok.nextToken())) {
-					matches = false;
-					break;
-				}
-			}
-
-			if (matches) {
-				_list.push_back(i->orig);
-				_listIndex.push_back(n);
-			}
-		}
+		// Restrict the list to everything which matches all tokens in _filter, ignoring case.
+		applyFilter();
 	}
 
 	_currentPos = 0;
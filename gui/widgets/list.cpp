@@ -201,6 +201,7 @@ void ListWidget::setList(const Common::U32StringArray &list) {
 	_list = list;
 	_filter.clear();
 	_listIndex.clear();
+	_listIndexFilter.clear();
 
 	int size = list.size();
 	if (_currentPos >= size)
@@ -217,9 +218,19 @@ void ListWidget::append(const Common::String &s) {
 	Common::U32String stripped = stripGUIformatting(s);
 	_dataList.push_back(ListData(s, stripped));
 	_cleanedList.push_back(stripped);
-	_list.push_back(s);
 
-	setFilter(_filter, false);
+	if (_filter.empty()) {
+		_list.push_back(s);
+	} else {
+		// Keep _list and _listIndex in sync with the active filter
+		Common::U32StringArray tokens;
+		tokenizeFilter(tokens);
+
+		if (itemMatchesFilter(_dataList.size() - 1, tokens)) {
+			_list.push_back(s);
+			_listIndex.push_back(_dataList.size() - 1);
+		}
+	}
 
 	scrollBarRecalc();
 }
@@ -747,6 +758,79 @@ void ListWidget::reflowLayout() {
 	}
 }
 
+const char *const ListWidget::kFilterOperators = "!:=~";
+
+bool ListWidget::isFilterNarrowing(const Common::U32String &oldFilter, const Common::U32String &newFilter) {
+	if (oldFilter.empty() || newFilter.size() <= oldFilter.size())
+		return false;
+
+	for (uint i = 0; i < oldFilter.size(); ++i) {
+		if (oldFilter[i] != newFilter[i])
+			return false;
+	}
+
+	// Additional tokens can only remove items
+	if (Common::isSpace(oldFilter.lastChar()) || Common::isSpace(newFilter[oldFilter.size()]))
+		return true;
+
+	// The last token got longer, which only narrows down plain substring matches
+	uint start = oldFilter.size();
+	while (start > 0 && !Common::isSpace(oldFilter[start - 1]))
+		--start;
+
+	for (uint i = start; i < newFilter.size() && !Common::isSpace(newFilter[i]); ++i) {
+		if (newFilter[i] < 0x80 && strchr(kFilterOperators, (char)newFilter[i]))
+			return false;
+	}
+
+	return true;
+}
+
+void ListWidget::tokenizeFilter(Common::U32StringArray &tokens) const {
+	Common::U32StringTokenizer tok(_filter);
+
+	tokens.clear();
+	while (!tok.empty())
+		tokens.push_back(tok.nextToken());
+}
+
+bool ListWidget::itemMatchesFilter(int idx, const Common::U32StringArray &tokens) const {
+	for (uint i = 0; i < tokens.size(); ++i) {
+		if (!_filterMatcher(_filterMatcherArg, idx, _dataList[idx].lower, tokens[i]))
+			return false;
+	}
+
+	return true;
+}
+
+void ListWidget::applyFilter() {
+	Common::U32StringArray tokens;
+	tokenizeFilter(tokens);
+
+	// While the filter is being typed it usually only gets longer. Then nothing
+	// which was filtered out before can match again, and only the items still
+	// shown need to be checked.
+	Common::Array<int> candidates;
+	bool narrowing = isFilterNarrowing(_listIndexFilter, _filter);
+	if (narrowing)
+		candidates.swap(_listIndex);
+
+	_list.clear();
+	_listIndex.clear();
+
+	uint count = narrowing ? candidates.size() : _dataList.size();
+	for (uint i = 0; i < count; ++i) {
+		int n = narrowing ? candidates[i] : (int)i;
+
+		if (itemMatchesFilter(n, tokens)) {
+			_list.push_back(_dataList[n].orig);
+			_listIndex.push_back(n);
+		}
+	}
+
+	_listIndexFilter = _filter;
+}
+
 void ListWidget::setFilter(const Common::U32String &filter, bool redraw) {
 	// FIXME: This method does not deal correctly with edit mode!
 	// Until we fix that, let's make sure it isn't called while editing takes place
@@ -769,33 +853,10 @@ void ListWidget::setFilter(const Common::U32String &filter, bool redraw) {
 			_list.push_back(_dataList[i].orig);
 
 		_listIndex.clear();
+		_listIndexFilter.clear();
 	} else {
 		// Restrict the list to everything which matches all tokens in _filter, ignoring case.
-
-		Common::U32StringTokenizer tok(_filter);
-		Common::U32String tmp;
-		int n = 0;
-
-		_list.clear();
-		_listIndex.clear();
-
-		for (auto i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = i->clean;
-			tmp.toLowercase();
-			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!_filterMatcher(_filterMatcherArg, n, tmp, tok.nextToken())) {
-					matches = false;
-					break;
-				}
-			}
-
-			if (matches) {
-				_list.push_back(i->orig);
-				_listIndex.push_back(n);
-			}
-		}
+		applyFilter();
 	}
 
 	_currentPos = 0;
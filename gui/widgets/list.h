@@ -50,13 +50,20 @@ enum {
 /* ListWidget */
 class ListWidget : public EditableWidget {
 public:
+	/**
+	 * Matches a single filter token against a lowercased item. Tokens which do not
+	 * contain any of the characters in kFilterOperators must be matched as plain
+	 * substrings: setFilter() relies on that when it only rechecks the items shown
+	 * for the previous filter.
+	 */
 	typedef bool (*FilterMatcher)(void *arg, int idx, const Common::U32String &item, const Common::U32String &token);
 
 	struct ListData {
 		Common::U32String orig;
 		Common::U32String clean;
+		Common::U32String lower;	///< clean, lowercased once for the filter
 
-		ListData(const Common::U32String &o, const Common::U32String &c) { orig = o; clean = c; }
+		ListData(const Common::U32String &o, const Common::U32String &c) { orig = o; clean = c; lower = c; lower.toLowercase(); }
 	};
 
 	typedef Common::Array<ListData> ListDataArray;
@@ -66,6 +73,7 @@ protected:
 	Common::U32StringArray	_cleanedList;
 	ListDataArray	_dataList;
 	Common::Array<int>	_listIndex;
+	Common::U32String	_listIndexFilter;	///< Filter _listIndex holds the matches of, if any
 	bool			_editable;
 	bool			_editMode;
 	NumberingMode	_numberingMode;
@@ -139,6 +147,16 @@ public:
 
 	void setFilter(const Common::U32String &filter, bool redraw = true);
 
+	/** Characters which give a filter token a meaning other than a plain substring. */
+	static const char *const kFilterOperators;
+
+	/**
+	 * Returns true if every item matching newFilter also matched oldFilter, i.e.
+	 * newFilter only appends to oldFilter, either new tokens or characters extending
+	 * a last token which is a plain substring.
+	 */
+	static bool isFilterNarrowing(const Common::U32String &oldFilter, const Common::U32String &newFilter);
+
 	void handleTickle() override;
 	void handleMouseDown(int x, int y, int button, int clickCount) override;
 	void handleMouseUp(int x, int y, int button, int clickCount) override;
@@ -173,6 +191,12 @@ protected:
 
 	void copyListData(const Common::U32StringArray &list);
 
+	/// Splits _filter into the tokens which all have to match an item.
+	void tokenizeFilter(Common::U32StringArray &tokens) const;
+	bool itemMatchesFilter(int idx, const Common::U32StringArray &tokens) const;
+	/// Rebuilds _list and _listIndex from the items matching the non-empty _filter.
+	void applyFilter();
+
 	void receivedFocusWidget() override;
 	void lostFocusWidget() override;
 	void checkBounds();